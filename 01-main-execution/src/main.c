@@ -23,7 +23,8 @@ void print_string(const char* str) {
 }
 
 void exit_program(int code) {
-    semihost_call(0x18, &code);  // SYS_EXIT
+    // SYS_EXIT: AArch32 는 r1 에 종료 사유를 값으로 받음 (ApplicationExit 이어야 QEMU 종료 코드 0)
+    semihost_call(0x18, (void*)(code == 0 ? 0x20026 : 0x20023));
     while(1);
 }
 
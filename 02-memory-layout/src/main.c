@@ -3,6 +3,10 @@
  * x^16 함수를 통한 데이터 영역과 포인터 학습
  */
 
+#include "power.h"
+#include "dwt.h"
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
+
 // ARM Semihosting
 int semihost_call(int reason, void* arg) {
     int result;
@@ -23,7 +27,8 @@ void print_string(const char* str) {
 }
 
 void exit_program(int code) {
-    semihost_call(0x18, &code);
+    // AArch32 SYS_EXIT 는 r1 에 종료 사유를 값으로 받음 (ApplicationExit 이어야 QEMU 종료 코드 0)
+    semihost_call(0x18, (void*)(code == 0 ? 0x20026 : 0x20023));
     while(1);
 }
 
@@ -38,38 +43,39 @@ int calculation_count;       // BSS 영역: 초기화되지 않은 변수
 int* dynamic_pointer;        // BSS 영역: 포인터 변수
 
 // === TEXT 영역에 저장되는 상수 데이터 ===
-const int CONSTANT_TABLE[5] = {1, 2, 4, 8, 16};  // RODATA/TEXT 영역
+// 2의 거듭제곱 표 gen_pow2_u32[32] 는 빌드 시 생성된 build/gen_tables.c 에 있음 (RODATA/TEXT 영역)
 
-// 간단한 출력 함수
+// 간단한 출력 함수 (두 자리씩 gen_dec_pairs 에서 복사 -> 나눗셈 횟수 절반)
 void print_number(int num) {
-    char buffer[20];
-    int i = 0;
+    char buffer[12];
+    int i = 11;
+    unsigned int value = num < 0 ? 0u - (unsigned int)num : (unsigned int)num;
     
-    if (num == 0) {
-        print_string("0");
-        return;
-    }
+    buffer[i] = '\0';
     
-    if (num < 0) {
-        print_string("-");
-        num = -num;
+    // 숫자를 문자열로 변환 (뒤에서부터 두 자리씩)
+    while (value >= 100) {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        buffer[--i] = gen_dec_pairs[pair + 1];
+        buffer[--i] = gen_dec_pairs[pair];
     }
-    
-    // 숫자를 문자열로 변환
-    while (num > 0) {
-        buffer[i++] = '0' + (num % 10);
-        num /= 10;
+    if (value >= 10) {
+        buffer[--i] = gen_dec_pairs[value * 2 + 1];
+        buffer[--i] = gen_dec_pairs[value * 2];
+    } else {
+        buffer[--i] = '0' + value;
     }
     
-    // 역순으로 출력
-    while (i > 0) {
-        char c[2] = {buffer[--i], '\0'};
-        print_string(c);
+    if (num < 0) {
+        buffer[--i] = '-';
     }
+    print_string(&buffer[i]);
 }
 
 // x^16을 계산하는 함수 (반복적으로)
-int power_of_16_iterative(int x) {
+// noinline: 벤치마크에서 power.c 함수들과 같은 호출 비용으로 비교
+__attribute__((noinline)) int power_of_16_iterative(int x) {
     int result = 1;
     for (int i = 0; i < 16; i++) {
         result *= x;
@@ -78,7 +84,8 @@ int power_of_16_iterative(int x) {
 }
 
 // x^16을 계산하는 함수 (재귀적으로 - 스택 사용량 증가)
-int power_of_16_recursive(int x, int exp) {
+// 주의: int 오버플로를 검사하지 않음 -> power_i32_checked() 참고
+__attribute__((noinline)) int power_of_16_recursive(int x, int exp) {
     if (exp == 0) return 1;
     if (exp == 1) return x;
     
@@ -111,8 +118,8 @@ void analyze_memory_regions() {
     print_number((int)&local_var);
     print_string("\n");
     
-    print_string("   RODATA constant table: CONSTANT_TABLE = ");
-    print_number((int)&CONSTANT_TABLE);
+    print_string("   RODATA constant table: gen_pow2_u32 = ");
+    print_number((int)gen_pow2_u32);
     print_string("\n");
     
     print_string("   Function address (TEXT): power_of_16_iterative = ");
@@ -162,6 +169,141 @@ void pointer_experiments() {
     print_string("\n\n");
 }
 
+// === 거듭제곱 모듈 (power.c) ===
+#define BENCH_ROUNDS 64
+
+volatile uint32_t bench_input[4] = {2, 3, 5, 7};   // DATA 영역: 상수 전파 방지
+volatile uint32_t bench_exponent = 16;
+volatile uint32_t bench_sink;
+
+int check_failures = 0;  // MISMATCH 가 있으면 실패 종료 코드
+
+void print_check(const char* label, int ok) {
+    print_string(label);
+    print_string(ok ? "OK\n" : "MISMATCH\n");
+    if (!ok) {
+        check_failures++;
+    }
+}
+
+// 빌드 시 생성된 테이블 확인 (모두 .rodata -> S_CODE_BOOT)
+// crc32 / sin / pow10 표는 이 검증에서만 쓰임 (실제 사용처는 print_number / print_hex 의 dec/hex 표)
+void generated_tables_demo() {
+    print_string("\n=== Generated Tables (tools/gentables) ===\n");
+    
+    // CRC-32 표준 검사값: "123456789" -> 0xCBF43926
+    print_check("1. gen_crc32(\"123456789\") == 0xCBF43926: ",
+                gen_crc32(0, "123456789", 9) == 0xCBF43926u);
+    
+    // 사인 표: 0, pi/2, pi, 3pi/2
+    print_check("2. gen_sin_q15[0, 64, 128, 192] == 0, 32767, 0, -32768: ",
+                gen_sin_q15[0] == 0 && gen_sin_q15[64] == 32767 &&
+                gen_sin_q15[128] == 0 && gen_sin_q15[192] == -32768);
+    
+    // 10의 거듭제곱 / 16진 문자 쌍
+    print_check("3. gen_pow10_u32[9] == 1000000000, gen_hex_pairs[0xA5] == \"A5\": ",
+                gen_pow10_u32[9] == 1000000000u &&
+                gen_hex_pairs[0xA5 * 2] == 'A' && gen_hex_pairs[0xA5 * 2 + 1] == '5');
+    
+    print_string("   gen_crc32_table = ");
+    print_number((int)gen_crc32_table);
+    print_string(" (");
+    print_number(sizeof(gen_crc32_table));
+    print_string(" bytes, RODATA)\n");
+}
+
+void power_module_demo() {
+    print_string("\n=== Power Module (square-and-multiply) ===\n");
+    
+    // 1. 임의 지수 / 상수 지수 특수화가 기존 함수와 같은 값인지
+    int same = 1;
+    for (uint32_t x = 1; x <= 3; x++) {
+        uint32_t expected = (uint32_t)power_of_16_iterative((int)x);
+        same &= power_u32(x, bench_exponent) == expected;
+        same &= POWER_U32(x, 16) == expected;
+    }
+    print_check("1. power_u32(x, 16) == power_of_16_iterative(x): ", same);
+    
+    // 2. 오버플로 검출 - 5^16 은 int 범위를 넘음 (기존 함수는 조용히 잘림)
+    int32_t r32;
+    print_string("2. power_i32_checked(5, 16): ");
+    print_string(power_i32_checked(5, 16, &r32) == POWER_OVERFLOW ? "overflow detected" : "no overflow?");
+    print_string(" (power_of_16_recursive(5, 16) = ");
+    print_number(power_of_16_recursive(5, 16));
+    print_string(")\n");
+    print_string("   power_i32_checked(-3, 19) = ");
+    print_number(power_i32_checked(-3, 19, &r32) == POWER_OK ? r32 : 0);
+    print_string("\n");
+    
+    // 3. 64비트 - 3^40 = 12157665459056928801 (0xA8B8B452291FE821)
+    uint64_t r64;
+    int ok64 = power_u64_checked(3, 40, &r64) == POWER_OK && r64 == 0xA8B8B452291FE821ull;
+    ok64 &= power_u64_checked(3, 41, &r64) == POWER_OVERFLOW;
+    print_check("3. power_u64_checked(3, 40) / overflow at 3^41: ", ok64);
+    
+    // 4. 모듈러 - 페르마 소정리: a^(p-1) mod p = 1 (p = 2147483647 = 2^31 - 1)
+    int okmod = power_mod_u32(123456789, 2147483646u, 2147483647u) == 1;
+    okmod &= power_mod_u32(2, 10, 1000) == 24;   // 짝수 모듈러 경로
+    print_check("4. power_mod_u32 (Montgomery / even modulus): ", okmod);
+}
+
+void power_benchmark() {
+    uint32_t start, cycles;
+    uint32_t x;
+    
+    print_string("\n=== x^16 Cycle Benchmark (");
+    print_number(BENCH_ROUNDS * 4);
+    print_string(" calls) ===\n");
+    dwt_init();
+    print_string(dwt_use_timer ? "cycle source: dual timer (QEMU, DWT not modelled)\n"
+                               : "cycle source: DWT CYCCNT\n");
+    
+    start = dwt_cycles();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < 4; i++) {
+            bench_sink = (uint32_t)power_of_16_iterative((int)bench_input[i]);
+        }
+    }
+    cycles = dwt_elapsed(start);
+    print_string("power_of_16_iterative  (16 MUL)  : ");
+    print_number((int)cycles);
+    print_string(" cycles\n");
+    
+    start = dwt_cycles();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < 4; i++) {
+            bench_sink = (uint32_t)power_of_16_recursive((int)bench_input[i], 16);
+        }
+    }
+    cycles = dwt_elapsed(start);
+    print_string("power_of_16_recursive  (stack)   : ");
+    print_number((int)cycles);
+    print_string(" cycles\n");
+    
+    start = dwt_cycles();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < 4; i++) {
+            bench_sink = power_u32(bench_input[i], bench_exponent);
+        }
+    }
+    cycles = dwt_elapsed(start);
+    print_string("power_u32              (runtime) : ");
+    print_number((int)cycles);
+    print_string(" cycles\n");
+    
+    start = dwt_cycles();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < 4; i++) {
+            x = bench_input[i];
+            bench_sink = POWER_U32(x, 16);
+        }
+    }
+    cycles = dwt_elapsed(start);
+    print_string("POWER_U32(x, 16)       (4 MUL)   : ");
+    print_number((int)cycles);
+    print_string(" cycles\n");
+}
+
 void main(void) {
     print_string("==========================================\n");
     print_string("Memory Layout Analysis - Text/Data/BSS\n");
@@ -215,16 +357,21 @@ void main(void) {
     
     print_string("\n=== Constant Table (RODATA) ===\n");
     for (int i = 0; i < 5; i++) {
-        print_string("CONSTANT_TABLE[");
+        print_string("gen_pow2_u32[");
         print_number(i);
         print_string("] = ");
-        print_number(CONSTANT_TABLE[i]);
+        print_number(gen_pow2_u32[i]);
         print_string("\n");
     }
+    generated_tables_demo();
+    
+    // 거듭제곱 모듈 + 사이클 비교
+    power_module_demo();
+    power_benchmark();
     
     print_string("\n==========================================\n");
     print_string("Memory layout analysis completed!\n");
     print_string("==========================================\n");
     
-    exit_program(0);
+    exit_program(check_failures);
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+/*
+ * 거듭제곱 모듈 구현
+ *
+ * 02 모듈은 -nostdlib 로 링크하므로 libgcc 의 64비트 나눗셈(__aeabi_uldivmod)을
+ * 쓸 수 없습니다. 모듈러 버전은 나눗셈 없이 몽고메리 곱셈으로 구현합니다.
+ */
+
+#include "power.h"
+
+uint32_t power_u32(uint32_t base, uint32_t exp)
+{
+    uint32_t result = 1;
+
+    while (exp) {
+        if (exp & 1) {
+            result *= base;
+        }
+        exp >>= 1;
+        if (exp) {
+            base *= base;   /* 마지막 제곱은 결과에 쓰이지 않으므로 생략 */
+        }
+    }
+    return result;
+}
+
+/* a * b 가 32비트를 넘으면 0 - UMULL 한 번, 상위 워드 검사 */
+static inline int mul_u32_ok(uint32_t a, uint32_t b, uint32_t *product)
+{
+    uint64_t full = (uint64_t)a * b;
+
+    *product = (uint32_t)full;
+    return (uint32_t)(full >> 32) == 0;
+}
+
+int power_u32_checked(uint32_t base, uint32_t exp, uint32_t *result)
+{
+    uint32_t acc = 1;
+
+    while (exp) {
+        if ((exp & 1) && !mul_u32_ok(acc, base, &acc)) {
+            return POWER_OVERFLOW;
+        }
+        exp >>= 1;
+        /* 남은 비트가 있을 때만 제곱 - 쓰이지 않는 제곱의 오버플로는 무시 */
+        if (exp && !mul_u32_ok(base, base, &base)) {
+            return POWER_OVERFLOW;
+        }
+    }
+    *result = acc;
+    return POWER_OK;
+}
+
+int power_i32_checked(int32_t base, uint32_t exp, int32_t *result)
+{
+    int32_t acc = 1;
+
+    while (exp) {
+        /* SMULL 후 상위 워드가 하위 워드의 부호 확장인지 검사 */
+        if ((exp & 1) && __builtin_mul_overflow(acc, base, &acc)) {
+            return POWER_OVERFLOW;
+        }
+        exp >>= 1;
+        if (exp && __builtin_mul_overflow(base, base, &base)) {
+            return POWER_OVERFLOW;
+        }
+    }
+    *result = acc;
+    return POWER_OK;
+}
+
+uint64_t power_u64(uint64_t base, uint32_t exp)
+{
+    uint64_t result = 1;
+
+    while (exp) {
+        if (exp & 1) {
+            result *= base;
+        }
+        exp >>= 1;
+        if (exp) {
+            base *= base;
+        }
+    }
+    return result;
+}
+
+/*
+ * 64 x 64 -> 128비트 곱의 상위 64비트가 0인지 검사.
+ * UMAAL RdLo, RdHi, Rn, Rm : {RdHi:RdLo} = Rn * Rm + RdLo + RdHi
+ * (두 번의 32비트 덧셈이 절대 64비트를 넘지 않으므로 캐리 전파를 한 명령어로 처리)
+ */
+static int mul_u64_ok(uint64_t a, uint64_t b, uint64_t *product)
+{
+    uint32_t a0 = (uint32_t)a, a1 = (uint32_t)(a >> 32);
+    uint32_t b0 = (uint32_t)b, b1 = (uint32_t)(b >> 32);
+    uint32_t w0, w1, w2, w3;
+
+    __asm__ (
+        "umull  %[w0], %[w1], %[a0], %[b0]\n\t"   /* w1:w0 = a0*b0 */
+        "movs   %[w2], #0\n\t"
+        "umaal  %[w1], %[w2], %[a1], %[b0]\n\t"   /* w2:w1 = a1*b0 + w1 */
+        "movs   %[w3], #0\n\t"
+        "umaal  %[w1], %[w3], %[a0], %[b1]\n\t"   /* w3:w1 = a0*b1 + w1 */
+        "umaal  %[w2], %[w3], %[a1], %[b1]"       /* w3:w2 = a1*b1 + w2 + w3 */
+        : [w0] "=&r" (w0), [w1] "=&r" (w1), [w2] "=&r" (w2), [w3] "=&r" (w3)
+        : [a0] "r" (a0), [a1] "r" (a1), [b0] "r" (b0), [b1] "r" (b1)
+        : "cc"
+    );
+
+    *product = ((uint64_t)w1 << 32) | w0;
+    return (w2 | w3) == 0;
+}
+
+int power_u64_checked(uint64_t base, uint32_t exp, uint64_t *result)
+{
+    uint64_t acc = 1;
+
+    while (exp) {
+        if ((exp & 1) && !mul_u64_ok(acc, base, &acc)) {
+            return POWER_OVERFLOW;
+        }
+        exp >>= 1;
+        if (exp && !mul_u64_ok(base, base, &base)) {
+            return POWER_OVERFLOW;
+        }
+    }
+    *result = acc;
+    return POWER_OK;
+}
+
+// ========== 모듈러 거듭제곱 ==========
+
+/*
+ * 몽고메리 곱셈 (R = 2^32, m 홀수, m < 2^31)
+ *   mont_mul(a, b) = a * b * R^-1 mod m
+ *   t = a*b (UMULL), u = t_lo * m' (MUL), t + u*m (UMLAL) 의 상위 워드가 결과.
+ *   t + u*m 은 하위 32비트가 항상 0 이므로 나눗셈 없이 >> 32 만으로 R 로 나뉩니다.
+ */
+static inline uint32_t mont_mul(uint32_t a, uint32_t b, uint32_t m, uint32_t m_neg_inv)
+{
+    uint64_t t = (uint64_t)a * b;
+    uint32_t u = (uint32_t)t * m_neg_inv;
+    uint32_t r = (uint32_t)((t + (uint64_t)u * m) >> 32);
+
+    return r >= m ? r - m : r;
+}
+
+static uint32_t power_mod_montgomery(uint32_t base, uint32_t exp, uint32_t m)
+{
+    /* m^-1 mod 2^32: 뉴턴 반복 (정확한 비트 수 3 -> 6 -> 12 -> 24 -> 48) */
+    uint32_t inv = m;
+    for (int i = 0; i < 4; i++) {
+        inv *= 2 - m * inv;
+    }
+    uint32_t m_neg_inv = 0 - inv;
+
+    /* R mod m, R^2 mod m (두 배 + 조건부 뺄셈 32회, m < 2^31 이므로 넘치지 않음) */
+    uint32_t r1 = (0 - m) % m;
+    uint32_t r2 = r1;
+    for (int i = 0; i < 32; i++) {
+        r2 <<= 1;
+        if (r2 >= m) {
+            r2 -= m;
+        }
+    }
+
+    uint32_t x = mont_mul(base % m, r2, m, m_neg_inv);   /* base * R mod m */
+    uint32_t acc = r1;                                   /* 1 * R mod m */
+
+    while (exp) {
+        if (exp & 1) {
+            acc = mont_mul(acc, x, m, m_neg_inv);
+        }
+        exp >>= 1;
+        if (exp) {
+            x = mont_mul(x, x, m, m_neg_inv);
+        }
+    }
+    return mont_mul(acc, 1, m, m_neg_inv);               /* 몽고메리 영역에서 복귀 */
+}
+
+/* a * b mod m (a, b < m < 2^31) - 덧셈과 두 배만 사용 */
+static uint32_t mul_mod_add(uint32_t a, uint32_t b, uint32_t m)
+{
+    uint32_t r = 0;
+
+    while (b) {
+        if (b & 1) {
+            r += a;
+            if (r >= m) r -= m;
+        }
+        a <<= 1;
+        if (a >= m) a -= m;
+        b >>= 1;
+    }
+    return r;
+}
+
+uint32_t power_mod_u32(uint32_t base, uint32_t exp, uint32_t mod)
+{
+    if (mod <= 1 || mod >= 0x80000000u) {
+        return 0;   /* 지원 범위 밖 */
+    }
+    if (mod & 1) {
+        return power_mod_montgomery(base, exp, mod);
+    }
+
+    uint32_t x = base % mod;
+    uint32_t acc = 1;
+    while (exp) {
+        if (exp & 1) {
+            acc = mul_mod_add(acc, x, mod);
+        }
+        exp >>= 1;
+        if (exp) {
+            x = mul_mod_add(x, x, mod);
+        }
+    }
+    return acc;
+}
@@ -0,0 +1,59 @@
+/*
+ * 거듭제곱 모듈 - power_of_16_iterative() 의 일반화
+ *
+ * 제곱-곱셈(square-and-multiply): 지수의 비트를 하위부터 보면서
+ *   base 를 계속 제곱하고, 비트가 1일 때만 결과에 곱합니다.
+ *   x^16 = ((x^2)^2)^2)^2  -> 곱셈 16번 대신 4번
+ *   곱셈 횟수는 exp 가 아니라 log2(exp) 에 비례합니다.
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+
+/* 오버플로 검출 결과 */
+#define POWER_OK        0
+#define POWER_OVERFLOW  (-1)
+
+/* 32비트: 결과는 2^32 로 나눈 나머지 (C의 unsigned 곱셈과 동일) */
+uint32_t power_u32(uint32_t base, uint32_t exp);
+
+/* 오버플로 검출 버전 - UMULL/SMULL 의 상위 워드로 판정 */
+int power_u32_checked(uint32_t base, uint32_t exp, uint32_t *result);
+int power_i32_checked(int32_t base, uint32_t exp, int32_t *result);
+
+/* 64비트: 곱셈 1회 = UMULL + MLA 2개 */
+uint64_t power_u64(uint64_t base, uint32_t exp);
+/* 64x64 -> 128비트 곱 (UMULL + UMAAL 3개)의 상위 64비트로 오버플로 판정 */
+int power_u64_checked(uint64_t base, uint32_t exp, uint64_t *result);
+
+/* base^exp mod m (1 < m < 2^31, 범위 밖이면 0). 홀수 m 은 몽고메리 곱셈, 짝수 m 은 덧셈-두배 방식 */
+uint32_t power_mod_u32(uint32_t base, uint32_t exp, uint32_t mod);
+
+/*
+ * 상수 지수 특수화: exp 가 컴파일 타임 상수이면 인라인되어 루프가
+ * 완전히 펼쳐집니다 (-O1 이상). POWER_U32(x, 16) -> MUL 4개.
+ * 상수가 아니면 일반 power_u32() 호출로 대체됩니다.
+ */
+static inline __attribute__((always_inline))
+uint32_t power_u32_inline(uint32_t base, uint32_t exp)
+{
+    uint32_t result = 1;
+
+    while (exp) {
+        if (exp & 1) {
+            result *= base;
+        }
+        exp >>= 1;
+        if (exp) {
+            base *= base;
+        }
+    }
+    return result;
+}
+
+#define POWER_U32(base, exp) \
+    (__builtin_constant_p(exp) ? power_u32_inline((base), (exp)) : power_u32((base), (exp)))
+
+#endif /* POWER_H */
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""
+정적 최악 스택 사용량 분석기 (Static worst-case stack usage)
+
+GCC의 -fstack-usage(.su) / -fcallgraph-info(.ci) 출력과 ELF 디스어셈블리에서
+얻은 호출 그래프를 합쳐 엔트리 포인트(main + 벡터 테이블의 각 핸들러)별
+최악 스택 깊이를 계산합니다.
+
+- 재귀(자기 호출, 상호 재귀)를 찾아 표시합니다.
+  재귀 함수는 --bound 함수=깊이 로 최대 깊이를 알려줘야 계산이 가능합니다.
+- 링커 스크립트의 __StackTop - __StackLimit 을 예산(budget)으로 사용하고,
+  최악 사용량이 예산을 넘거나 상한이 없는 재귀가 있으면 종료 코드 1로
+  빌드를 실패시킵니다.
+
+사용 예:
+  stack_usage.py --elf build/app.elf --bound factorial_recursive=5 build/*.su
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# Cortex-M 예외 진입 시 하드웨어가 쌓는 기본 프레임 (R0-R3, R12, LR, PC, xPSR)
+EXCEPTION_FRAME_BYTES = 32
+
+SU_LINE = re.compile(r'^(?P<loc>.*):(?P<name>[^:\s]+)\t(?P<size>\d+)\t(?P<qual>.*)$')
+CI_NODE = re.compile(r'node:\s*\{\s*title:\s*"(?P<title>[^"]*)"\s*label:\s*"(?P<label>[^"]*)"')
+CI_EDGE = re.compile(r'edge:\s*\{\s*sourcename:\s*"(?P<src>[^"]*)"\s*targetname:\s*"(?P<dst>[^"]*)"')
+OBJDUMP_FUNC = re.compile(r'^[0-9a-f]+ <(?P<name>[^>]+)>:$')
+OBJDUMP_CALL = re.compile(r'\t(?P<op>blx?|b\.w|b)(?:\.n)?\s+[0-9a-f]+ <(?P<target>[^>+]+)>$')
+NM_LINE = re.compile(r'^(?P<addr>[0-9a-f]+)\s+(?P<type>\w)\s+(?P<name>\S+)$')
+
+
+def run(cmd):
+    return subprocess.run(cmd, check=True, stdout=subprocess.PIPE,
+                          universal_newlines=True).stdout
+
+
+def parse_su(paths):
+    """함수별 스택 프레임 크기와 한정자(static/dynamic/bounded)"""
+    frames = {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                m = SU_LINE.match(line.rstrip('\n'))
+                if m:
+                    frames[m.group('name')] = (int(m.group('size')), m.group('qual'))
+    return frames
+
+
+def parse_ci(paths, graph):
+    """-fcallgraph-info 의 VCG 파일에서 호출 간선을 추가"""
+    for path in paths:
+        if not os.path.exists(path):
+            continue
+        names = {}
+        with open(path) as f:
+            text = f.read()
+        for m in CI_NODE.finditer(text):
+            names[m.group('title')] = m.group('label').split('\\n')[0]
+        for m in CI_EDGE.finditer(text):
+            src = names.get(m.group('src'), m.group('src'))
+            dst = names.get(m.group('dst'), m.group('dst'))
+            graph.setdefault(src, set()).add(dst)
+
+
+def parse_objdump(elf, objdump, graph):
+    """ELF 디스어셈블리의 bl/blx/b.w 로 호출 간선을 추가 (어셈블리 함수, 꼬리 호출 포함)"""
+    current = None
+    for line in run([objdump, '-d', elf]).splitlines():
+        m = OBJDUMP_FUNC.match(line)
+        if m:
+            current = m.group('name')
+            graph.setdefault(current, set())
+            continue
+        m = OBJDUMP_CALL.search(line)
+        if m and current and m.group('target') != current:
+            graph[current].add(m.group('target'))
+        elif m and current and m.group('op').startswith('bl'):
+            graph[current].add(current)
+
+
+def parse_symbols(elf, nm):
+    by_name, by_addr = {}, {}
+    for line in run([nm, '-n', elf]).splitlines():
+        m = NM_LINE.match(line)
+        if m:
+            addr = int(m.group('addr'), 16)
+            by_name[m.group('name')] = addr
+            if m.group('type') in 'Tt':
+                by_addr.setdefault(addr, m.group('name'))
+    return by_name, by_addr
+
+
+def vector_handlers(elf, objdump, by_addr):
+    """.isr_vector 의 두 번째 워드부터를 핸들러 주소로 해석"""
+    words = []
+    for line in run([objdump, '-s', '-j', '.isr_vector', elf]).splitlines():
+        parts = line.split()
+        if len(parts) < 2 or not re.match(r'^[0-9a-f]{8}$', parts[0]):
+            continue
+        for group in parts[1:5]:
+            if not re.match(r'^[0-9a-f]{8}$', group):
+                break
+            words.append(int.from_bytes(bytes.fromhex(group), 'little'))
+    handlers = []
+    for word in words[1:]:
+        name = by_addr.get(word & ~1)
+        if word and name and name not in handlers:
+            handlers.append(name)
+    return handlers
+
+
+def strongly_connected(graph):
+    """Tarjan SCC - 재귀(사이클)에 속한 함수 집합을 찾는다"""
+    index, low, stack, on_stack, result = {}, {}, [], set(), []
+    counter = [0]
+
+    def visit(v):
+        index[v] = low[v] = counter[0]
+        counter[0] += 1
+        stack.append(v)
+        on_stack.add(v)
+        for w in graph.get(v, ()):
+            if w not in index:
+                visit(w)
+                low[v] = min(low[v], low[w])
+            elif w in on_stack:
+                low[v] = min(low[v], index[w])
+        if low[v] == index[v]:
+            scc = set()
+            while True:
+                w = stack.pop()
+                on_stack.discard(w)
+                scc.add(w)
+                if w == v:
+                    break
+            result.append(scc)
+
+    sys.setrecursionlimit(10000)
+    for v in list(graph):
+        if v not in index:
+            visit(v)
+    return result
+
+
+class Analyzer:
+    def __init__(self, graph, frames, bounds):
+        self.graph = graph
+        self.frames = frames
+        self.bounds = bounds
+        self.memo = {}
+        self.recursive = {}
+        self.warnings = []
+        for scc in strongly_connected(graph):
+            if len(scc) > 1 or any(v in graph.get(v, ()) for v in scc):
+                for v in scc:
+                    self.recursive[v] = scc
+
+    def frame(self, name):
+        if name not in self.frames:
+            return 0
+        size, qual = self.frames[name]
+        if 'dynamic' in qual and 'bounded' not in qual:
+            self.warn('%s: dynamic stack frame (alloca/VLA), using static part only' % name)
+        return size
+
+    def warn(self, msg):
+        if msg not in self.warnings:
+            self.warnings.append(msg)
+
+    def worst(self, name):
+        """name 에서 시작하는 최악 스택 깊이와 경로. 상한이 없으면 (None, 경로)"""
+        if name in self.memo:
+            return self.memo[name]
+        self.memo[name] = (None, [name])  # 계산 중인 사이클 보호
+
+        callees = sorted(self.graph.get(name, ()))
+        if name == '__indirect_call' or '__indirect_call' in callees:
+            self.warn('%s: indirect call, target stack usage not counted' % name)
+        if name not in self.frames and name != '__indirect_call':
+            self.warn('%s: no .su entry (assembly/library), assuming 0 bytes' % name)
+
+        scc = self.recursive.get(name)
+        repeat = 1
+        if scc:
+            if len(scc) > 1 or name not in self.bounds:
+                self.memo[name] = (None, [name])
+                return self.memo[name]
+            repeat = self.bounds[name]
+            callees = [c for c in callees if c != name]
+
+        deepest, path = 0, []
+        for callee in callees:
+            if callee == '__indirect_call':
+                continue
+            depth, sub = self.worst(callee)
+            if depth is None:
+                self.memo[name] = (None, [name] + sub)
+                return self.memo[name]
+            if depth > deepest or not path:
+                deepest, path = depth, sub
+
+        total = self.frame(name) * repeat + deepest
+        label = name if repeat == 1 else '%s x%d' % (name, repeat)
+        self.memo[name] = (total, [label] + path)
+        return self.memo[name]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--elf', required=True)
+    parser.add_argument('--objdump', default='arm-none-eabi-objdump')
+    parser.add_argument('--nm', default='arm-none-eabi-nm')
+    parser.add_argument('--bound', action='append', default=[], metavar='FUNC=DEPTH',
+                        help='재귀 함수의 최대 재귀 깊이')
+    parser.add_argument('--entry', action='append', default=['main'],
+                        help='추가 엔트리 포인트 (기본: main + 벡터 테이블 핸들러)')
+    parser.add_argument('su_files', nargs='+')
+    args = parser.parse_args()
+
+    bounds = {}
+    for item in args.bound:
+        func, _, depth = item.partition('=')
+        bounds[func] = int(depth)
+
+    frames = parse_su(args.su_files)
+    graph = {}
+    parse_ci([os.path.splitext(p)[0] + '.ci' for p in args.su_files], graph)
+    parse_objdump(args.elf, args.objdump, graph)
+    by_name, by_addr = parse_symbols(args.elf, args.nm)
+    handlers = vector_handlers(args.elf, args.objdump, by_addr)
+
+    if '__StackTop' not in by_name or '__StackLimit' not in by_name:
+        print('ERROR: __StackTop/__StackLimit not defined by the linker script')
+        return 1
+    budget = by_name['__StackTop'] - by_name['__StackLimit']
+
+    analyzer = Analyzer(graph, frames, bounds)
+    entries = list(dict.fromkeys(args.entry + handlers))
+
+    print('=== Static Stack Usage (worst case) ===')
+    print('%-28s %8s  %s' % ('entry', 'bytes', 'deepest path'))
+    thread_worst, exception_total, failed = 0, 0, False
+    for entry in entries:
+        depth, path = analyzer.worst(entry)
+        if depth is None:
+            print('%-28s %8s  %s' % (entry, 'UNBOUND', ' -> '.join(path)))
+            failed = True
+            continue
+        is_exception = entry in handlers and entry != 'Reset_Handler'
+        if is_exception:
+            depth += EXCEPTION_FRAME_BYTES
+            exception_total += depth
+        else:
+            thread_worst = max(thread_worst, depth)
+        print('%-28s %8d  %s' % (entry, depth, ' -> '.join(path)))
+
+    print('')
+    print('Recursion:')
+    recursive = sorted(analyzer.recursive)
+    if not recursive:
+        print('  (none)')
+    for name in recursive:
+        scc = analyzer.recursive[name]
+        kind = 'self' if len(scc) == 1 else 'mutual with ' + ', '.join(sorted(scc - {name}))
+        if len(scc) == 1 and name in bounds:
+            print('  %-26s %s recursion, bounded to depth %d' % (name, kind, bounds[name]))
+        else:
+            print('  %-26s %s recursion, NO BOUND (use --bound %s=N)' % (name, kind, name))
+
+    for msg in analyzer.warnings:
+        print('warning: ' + msg)
+
+    worst = thread_worst + exception_total
+    print('')
+    print('Worst case: %d bytes (thread %d + nested exceptions %d)'
+          % (worst, thread_worst, exception_total))
+    print('Budget:     %d bytes (__StackTop - __StackLimit)' % budget)
+
+    if failed:
+        print('FAILED: unbounded stack usage')
+        return 1
+    if worst > budget:
+        print('FAILED: stack budget exceeded by %d bytes' % (worst - budget))
+        return 1
+    print('OK: %d bytes of headroom' % (budget - worst))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,14 +1,105 @@
 /*
  * Simple Boot Assembly for Cortex-M
  * Based on working armv8m-hello example
+ *
+ * 표준 스타트업: .data 복사, .bss 초기화, 스택 페인팅 후 main 진입
+ * 부팅 사이클(__boot_cycles)은 페인팅 전에 기록하고, 페인팅 비용은 __paint_cycles 에 따로 기록
+ * (최소 초기화 버전은 boot_fast.s - make FAST_BOOT=1)
  */
 
+    .syntax unified
+    .thumb
+
+/* 스택 페인팅 패턴 (main.c의 STACK_PAINT_PATTERN과 동일) */
+    .equ    STACK_PAINT_PATTERN, 0xDEADBEEF
+
 .section .isr_vector 	
     .long    __StackTop         /* Initial Top of Stack */
     .long    Reset_Handler      /* Reset Handler */
+    .long    Default_Handler    /* NMI */
+    .long    StackGuard_Handler /* HardFault - MPU 스택 가드 (main.c) */
+    .long    StackGuard_Handler /* MemManage - MPU 스택 가드 (main.c) */
    
 .text
+.thumb_func
 .global Reset_Handler
 Reset_Handler:  
+    /* 부팅 사이클 측정 시작: SysTick을 프로세서 클럭으로 자유 실행 */
+    ldr     r0, =0xE000E010          /* SYST_CSR */
+    ldr     r1, =0x00FFFFFF
+    str     r1, [r0, #4]             /* SYST_RVR = 최대값 */
+    str     r1, [r0, #8]             /* SYST_CVR 쓰기 = 0으로 클리어 */
+    movs    r1, #5                   /* CLKSOURCE=프로세서 클럭, ENABLE */
+    str     r1, [r0]
+
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
+
+    /* __boot_cycles = 0xFFFFFF - SYST_CVR: 다른 모듈과 같은 구간(리셋~C 런타임 초기화)만 셈 */
+    ldr     r0, =0xE000E010
+    ldr     r4, [r0, #8]             /* r4 = 페인팅 시작 시점의 SYST_CVR */
+    ldr     r2, =0x00FFFFFF
+    subs    r1, r2, r4
+    ldr     r2, =__boot_cycles
+    str     r1, [r2]
+
+    /* 스택 영역 전체(__StackLimit ~ SP)를 패턴으로 칠함 - High-Water Mark 측정용 */
+    ldr     R0, =__StackLimit
+    mov     R1, sp
+    ldr     R2, =STACK_PAINT_PATTERN
+paint_loop:
+    cmp     R0, R1
+    bhs     paint_done
+    str     R2, [R0], #4
+    b       paint_loop
+paint_done:
+
+    /* main 직전: __paint_cycles = 페인팅 전후 SYST_CVR 차이 (하향 카운터), SysTick 정지 */
+    ldr     r0, =0xE000E010
+    ldr     r1, [r0, #8]
+    movs    r2, #0
+    str     r2, [r0]
+    subs    r1, r4, r1
+    ldr     r2, =__paint_cycles
+    str     r1, [r2]
+
     ldr     R0, = main
     bx      R0
+
+.thumb_func
+.global Default_Handler
+Default_Handler:
+    b       Default_Handler
+
+/* 리셋부터 .bss 초기화까지 걸린 사이클 (GDB: x/wx &__boot_cycles) */
+/* 스택 페인팅에 걸린 사이클 - 64KB 를 칠하므로 부팅 비용과 따로 봄 (GDB: x/wx &__paint_cycles) */
+    .bss
+    .align  2
+    .global __boot_cycles
+__boot_cycles:
+    .space  4
+    .global __paint_cycles
+__paint_cycles:
+    .space  4
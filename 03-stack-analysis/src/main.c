@@ -3,6 +3,9 @@
  * 재귀 함수와 깊은 호출 스택을 통한 스택 메모리 이해
  */
 
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
+#include "stack_bounds.h" // 재귀 최대 깊이 (Makefile 의 stack-check 와 공유)
+
 // ARM Semihosting
 int semihost_call(int reason, void* arg) {
     int result;
@@ -23,7 +26,8 @@ void print_string(const char* str) {
 }
 
 void exit_program(int code) {
-    semihost_call(0x18, &code);
+    // AArch32 SYS_EXIT 는 r1 에 종료 사유를 값으로 받음 (ApplicationExit 이어야 QEMU 종료 코드 0)
+    semihost_call(0x18, (void*)(code == 0 ? 0x20026 : 0x20023));
     while(1);
 }
 
@@ -34,39 +38,47 @@ int stack_overflow_detected = 0;
 
 // 간단한 출력 함수들
 void print_number(int num) {
-    char buffer[20];
-    int i = 0;
-    
-    if (num == 0) {
-        print_string("0");
-        return;
+    char buffer[12];
+    int i = 11;
+    unsigned int value = num < 0 ? 0u - (unsigned int)num : (unsigned int)num;
+    
+    buffer[i] = '\0';
+    
+    // 두 자리씩 gen_dec_pairs 에서 복사 (나눗셈 횟수 절반, 출력 호출 1회)
+    while (value >= 100) {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        buffer[--i] = gen_dec_pairs[pair + 1];
+        buffer[--i] = gen_dec_pairs[pair];
     }
-    
-    if (num < 0) {
-        print_string("-");
-        num = -num;
-    }
-    
-    while (num > 0) {
-        buffer[i++] = '0' + (num % 10);
-        num /= 10;
+    if (value >= 10) {
+        buffer[--i] = gen_dec_pairs[value * 2 + 1];
+        buffer[--i] = gen_dec_pairs[value * 2];
+    } else {
+        buffer[--i] = '0' + value;
     }
     
-    while (i > 0) {
-        char c[2] = {buffer[--i], '\0'};
-        print_string(c);
+    if (num < 0) {
+        buffer[--i] = '-';
     }
+    print_string(&buffer[i]);
 }
 
 void print_hex(unsigned int value) {
-    print_string("0x");
-    char hex_chars[] = "0123456789ABCDEF";
+    char hex_str[11];
     
-    for (int i = 7; i >= 0; i--) {
-        int digit = (value >> (i * 4)) & 0xF;
-        char c[2] = {hex_chars[digit], '\0'};
-        print_string(c);
+    hex_str[0] = '0';
+    hex_str[1] = 'x';
+    
+    // 바이트마다 gen_hex_pairs 에서 두 글자 (매 호출 스택에 표를 만들지 않음)
+    for (int i = 3; i >= 0; i--) {
+        unsigned int pair = (value & 0xFF) * 2;
+        hex_str[2 + i * 2] = gen_hex_pairs[pair];
+        hex_str[3 + i * 2] = gen_hex_pairs[pair + 1];
+        value >>= 8;
     }
+    hex_str[10] = '\0';
+    print_string(hex_str);
 }
 
 // 스택 포인터 읽기
@@ -76,27 +88,114 @@ unsigned int get_stack_pointer() {
     return sp;
 }
 
-// 현재 스택 프레임 정보 출력
-void print_stack_info(const char* function_name, int local_var) {
-    print_string("=== Stack Info: ");
-    print_string(function_name);
-    print_string(" ===\n");
-    
-    print_string("  Current SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
-    
-    print_string("  Local var address: ");
-    print_hex((unsigned int)&local_var);
-    print_string("\n");
-    
-    print_string("  Local var value: ");
-    print_number(local_var);
+// === 스택 페인팅 (High-Water Mark 측정) ===
+// boot.s가 부팅 시 __StackLimit ~ __StackTop 을 패턴으로 칠해둠.
+// 함수가 사용한 스택은 패턴이 덮어써지므로, 아래에서부터 패턴이 남아있는
+// 워드를 건너뛰면 가장 깊이 사용된 주소를 한 번에 알 수 있음.
+#define STACK_PAINT_PATTERN 0xDEADBEEFu  // boot.s와 동일
+
+extern unsigned int __StackLimit[];  // 링커 스크립트에서 정의
+extern unsigned int __StackTop[];
+
+// 현재 SP 아래 영역을 다시 칠함 (다음 측정 준비)
+// naked: 자기 스택 프레임이 없어야 호출자의 SP 바로 아래까지 안전하게 칠할 수 있음
+__attribute__((naked)) void stack_paint(void) {
+    __asm__ volatile (
+        "movw r0, #:lower16:__StackLimit\n"
+        "movt r0, #:upper16:__StackLimit\n"
+        "movw r2, #0xBEEF\n"          // STACK_PAINT_PATTERN
+        "movt r2, #0xDEAD\n"
+        "mov  r1, sp\n"
+        "1:\n"
+        "cmp  r0, r1\n"
+        "bhs  2f\n"
+        "str  r2, [r0], #4\n"
+        "b    1b\n"
+        "2:\n"
+        "bx   lr\n"
+    );
+}
+
+// 가장 깊이 사용된 스택 주소 (패턴이 깨진 첫 워드)
+// 4워드씩 비교해서 빠르게 건너뛴 뒤 1워드 단위로 정확한 위치를 찾음
+unsigned int stack_high_water_mark(void) {
+    const unsigned int* p = __StackLimit;
+    const unsigned int* top = __StackTop;
+    
+    while (p + 4 <= top &&
+           ((p[0] ^ STACK_PAINT_PATTERN) | (p[1] ^ STACK_PAINT_PATTERN) |
+            (p[2] ^ STACK_PAINT_PATTERN) | (p[3] ^ STACK_PAINT_PATTERN)) == 0) {
+        p += 4;
+    }
+    while (p < top && *p == STACK_PAINT_PATTERN) {
+        p++;
+    }
+    return (unsigned int)p;
+}
+
+// === MPU 스택 가드 (17-mpu 와 같은 PMSAv8 레지스터) ===
+// __StackGuard ~ __StackLimit (링커 스크립트, 256바이트)를 읽기 전용 + XN 영역으로 설정.
+// PMSAv8 에는 특권 모드 접근 금지 권한이 없으므로 쓰기만 막음 - 스택은 아래로 자라며 쓰므로 충분.
+// 나머지 주소는 PRIVDEFENA 로 기본 메모리 맵을 그대로 쓰므로 영역 하나로 끝남 (런타임 비용 없음).
+#define MPU_CTRL            (*(volatile unsigned int*)0xE000ED94)
+#define MPU_RNR             (*(volatile unsigned int*)0xE000ED98)
+#define MPU_RBAR            (*(volatile unsigned int*)0xE000ED9C)
+#define MPU_RLAR            (*(volatile unsigned int*)0xE000EDA0)
+#define MPU_MAIR0           (*(volatile unsigned int*)0xE000EDC0)
+#define SCB_SHCSR           (*(volatile unsigned int*)0xE000ED24)
+#define SCB_CFSR            (*(volatile unsigned int*)0xE000ED28)
+#define SCB_MMFAR           (*(volatile unsigned int*)0xE000ED34)
+
+extern unsigned int __StackGuard[];  // 링커 스크립트에서 정의 (__StackLimit - 256)
+
+void stack_guard_init(void) {
+    MPU_CTRL = 0;
+    MPU_MAIR0 = 0xFF;                                   // 속성 0: Normal, write-back
+    MPU_RNR = 0;
+    MPU_RBAR = (unsigned int)__StackGuard | (3u << 3)  // SH = inner
+             | (2u << 1) | 1u;                          // AP = RO (특권), XN
+    MPU_RLAR = (((unsigned int)__StackLimit - 1) & ~31u) | 1u;  // 속성 0, EN
+    SCB_SHCSR |= 1u << 16;                              // MEMFAULTENA
+    MPU_CTRL = (1u << 2) | 1u;                          // PRIVDEFENA, ENABLE
+    __asm__ volatile ("dsb\n\tisb" : : : "memory");
+}
+
+// 가드에 쓰기가 닿으면 여기서 보고하고 실패로 종료
+__attribute__((used, noreturn)) void stack_guard_report(void) {
+    unsigned int cfsr = SCB_CFSR;
+    
+    print_string("\n*** MPU stack guard hit: CFSR=");
+    print_hex(cfsr);
+    if (cfsr & (1u << 7)) {                              // MMARVALID
+        print_string(", MMFAR=");
+        print_hex(SCB_MMFAR);
+    }
+    print_string(" ***\n");
+    exit_program(1);
+    while (1);
+}
+
+// MemManage / HardFault (boot.s 벡터): 넘친 SP 는 가드 안이므로 C 코드가 쓸 수 없음.
+// 스택을 __StackTop 으로 되돌린 뒤 보고 (돌아가지 않음)
+__attribute__((naked)) void StackGuard_Handler(void) {
+    __asm__ volatile (
+        "movw r0, #:lower16:__StackTop\n"
+        "movt r0, #:upper16:__StackTop\n"
+        "mov  sp, r0\n"
+        "b    stack_guard_report\n"
+    );
+}
+
+// base_sp(측정 시작 시점의 SP) 기준 최대 스택 사용량 출력
+// hwm 은 테스트 직후에 읽어 둔 값 (print_* 호출이 쓴 스택이 섞이지 않도록)
+void print_stack_peak(const char* test_name, unsigned int base_sp, unsigned int hwm) {
+    print_string("  Peak stack usage (");
+    print_string(test_name);
+    print_string("): ");
+    print_number(base_sp - hwm);
+    print_string(" bytes, deepest SP: ");
+    print_hex(hwm);
     print_string("\n");
-    
-    print_string("  Global depth: ");
-    print_number(global_depth_counter);
-    print_string("\n\n");
 }
 
 // 단순한 재귀 함수 - 팩토리얼 계산
@@ -104,36 +203,20 @@ int factorial_recursive(int n, int depth) {
     int local_result = 1;
     global_depth_counter = depth;
     
-    print_string("Factorial(");
-    print_number(n);
-    print_string(") - Depth: ");
-    print_number(depth);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
-    
     // 기저 조건
     if (n <= 1) {
-        print_string("  Base case reached!\n");
         return 1;
     }
     
     // 재귀 호출
     local_result = n * factorial_recursive(n - 1, depth + 1);
     
-    print_string("Returning from depth ");
-    print_number(depth);
-    print_string(", result: ");
-    print_number(local_result);
-    print_string("\n");
-    
     return local_result;
 }
 
 // 피보나치 수열 (비효율적인 재귀) - 스택 사용량 증가
 int fibonacci_recursive(int n, int depth) {
     int local_var1 = n;
-    int local_var2 = depth;
     
     global_depth_counter++;
     if (global_depth_counter > max_recursion_depth) {
@@ -141,35 +224,29 @@ int fibonacci_recursive(int n, int depth) {
     }
     
     // 깊이가 너무 깊어지면 스택 오버플로우 방지
-    if (depth > 15) {
+    if (depth >= STACK_BOUND_fibonacci_recursive) {
         print_string("  Depth limit reached to prevent stack overflow!\n");
         global_depth_counter--;
         return 0;
     }
     
-    print_stack_info("fibonacci_recursive", local_var1);
-    
-    if (n <= 1) {
+    if (local_var1 <= 1) {
         global_depth_counter--;
         return n;
     }
     
-    int result1 = fibonacci_recursive(n - 1, depth + 1);
-    int result2 = fibonacci_recursive(n - 2, depth + 1);
+    int result1 = fibonacci_recursive(local_var1 - 1, depth + 1);
+    int result2 = fibonacci_recursive(local_var1 - 2, depth + 1);
     
     global_depth_counter--;
     return result1 + result2;
 }
 
 // 깊은 함수 호출 체인
+// 지역 변수는 volatile: 출력 없이도 최적화(-O2)로 제거되지 않고 실제 스택을 사용
 void deep_call_level_5(int value) {
-    int local_array[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    volatile int local_array[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
     print_string("Level 5 - Large local array allocated\n");
-    print_string("  Array address: ");
-    print_hex((unsigned int)local_array);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
     
     // 배열 사용
     for (int i = 0; i < 10; i++) {
@@ -185,13 +262,8 @@ void deep_call_level_5(int value) {
 }
 
 void deep_call_level_4(int value) {
-    char local_buffer[50];
+    volatile char local_buffer[50];
     print_string("Level 4 - String buffer allocated\n");
-    print_string("  Buffer address: ");
-    print_hex((unsigned int)local_buffer);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
     
     // 버퍼 사용 (간단한 문자열 복사)
     const char* msg = "Hello Stack!";
@@ -199,50 +271,37 @@ void deep_call_level_4(int value) {
         local_buffer[i] = msg[i];
     }
     local_buffer[12] = '\0';
+    (void)local_buffer;
     
     deep_call_level_5(value + 1);
 }
 
 void deep_call_level_3(int value) {
-    double local_double = 3.14159;
+    volatile double local_double = 3.14159;
     print_string("Level 3 - Double variable allocated\n");
-    print_string("  Double address: ");
-    print_hex((unsigned int)&local_double);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
+    (void)local_double;
     
     deep_call_level_4(value + 1);
 }
 
 void deep_call_level_2(int value) {
-    int local_vars[5] = {10, 20, 30, 40, 50};
+    volatile int local_vars[5] = {10, 20, 30, 40, 50};
     print_string("Level 2 - Integer array allocated\n");
-    print_string("  Array address: ");
-    print_hex((unsigned int)local_vars);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
     
-    deep_call_level_3(value + 1);
+    deep_call_level_3(value + local_vars[0]);
 }
 
 void deep_call_level_1(int value) {
-    int local_int = value * 2;
+    volatile int local_int = value * 2;
     print_string("Level 1 - Single integer allocated\n");
-    print_string("  Integer address: ");
-    print_hex((unsigned int)&local_int);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
     
     deep_call_level_2(local_int);
 }
 
 // 스택 오버플로우 시뮬레이션 (위험한 함수 - 제한적으로 실행)
 void dangerous_recursive_function(int depth) {
-    char large_buffer[200];  // 큰 로컬 버퍼
-    int local_vars[20];      // 추가 로컬 변수들
+    volatile char large_buffer[200];  // 큰 로컬 버퍼
+    volatile int local_vars[20];      // 추가 로컬 변수들
     
     // 버퍼 초기화 (스택 사용)
     for (int i = 0; i < 200; i++) {
@@ -252,24 +311,20 @@ void dangerous_recursive_function(int depth) {
         local_vars[i] = depth * i;
     }
     
-    print_string("Dangerous depth: ");
-    print_number(depth);
-    print_string(", SP: ");
-    print_hex(get_stack_pointer());
-    print_string("\n");
-    
     // 안전 장치: 깊이 제한
-    if (depth > 20) {
-        print_string("SAFETY LIMIT REACHED - Preventing stack overflow!\n");
+    if (depth >= STACK_BOUND_dangerous_recursive_function) {
+        print_string("SAFETY LIMIT REACHED at depth ");
+        print_number(depth);
+        print_string(" - Preventing stack overflow!\n");
         stack_overflow_detected = 1;
         return;
     }
     
-    // 현재 스택 포인터가 너무 낮아지면 중단
+    // 현재 스택 포인터가 스택 영역 하한(__StackLimit)에 닿으면 중단
     unsigned int current_sp = get_stack_pointer();
-    unsigned int stack_limit = 0x10070000;  // 안전한 하한선
+    unsigned int stack_limit = (unsigned int)__StackLimit;
     
-    if (current_sp < stack_limit) {
+    if (current_sp < stack_limit + sizeof(large_buffer) + sizeof(local_vars)) {
         print_string("STACK LIMIT REACHED - Aborting!\n");
         stack_overflow_detected = 1;
         return;
@@ -283,6 +338,14 @@ void main(void) {
     print_string("Stack Analysis - Function Calls & Stack Growth\n");
     print_string("===============================================\n");
     
+    // 스택이 예산을 넘어 .bss 로 내려가면 조용히 덮어쓰지 않고 MemManage
+    stack_guard_init();
+    print_string("\nMPU stack guard (write -> MemManage): ");
+    print_hex((unsigned int)__StackGuard);
+    print_string(" - ");
+    print_hex((unsigned int)__StackLimit);
+    print_string("\n");
+    
     // 초기 스택 상태
     int main_local = 42;
     print_string("\n=== Initial Stack State ===\n");
@@ -293,42 +356,71 @@ void main(void) {
     print_hex((unsigned int)&main_local);
     print_string("\n\n");
     
+    // 각 테스트 전에 stack_paint()로 다시 칠하고, 끝나자마자 출력 전에 한 번만 측정
+    unsigned int main_sp = get_stack_pointer();
+    unsigned int hwm;
+    
     // 1. 간단한 재귀 함수 테스트
     print_string("=== Test 1: Simple Factorial Recursion ===\n");
     global_depth_counter = 0;
-    int factorial_5 = factorial_recursive(5, 1);
-    print_string("Result: 5! = ");
-    print_number(factorial_5);
-    print_string("\n\n");
+    stack_paint();
+    int factorial_n = STACK_BOUND_factorial_recursive;  // 깊이 = n 이므로 bound 를 그대로 입력으로 씀
+    int factorial_result = factorial_recursive(factorial_n, 1);
+    hwm = stack_high_water_mark();
+    print_string("Result: ");
+    print_number(factorial_n);
+    print_string("! = ");
+    print_number(factorial_result);
+    print_string(", depth: ");
+    print_number(global_depth_counter);
+    print_string("\n");
+    print_stack_peak("factorial_recursive(n)", main_sp, hwm);
+    print_string("\n");
     
     // 2. 피보나치 재귀 (더 복잡한 스택 사용)
     print_string("=== Test 2: Fibonacci Recursion ===\n");
     global_depth_counter = 0;
     max_recursion_depth = 0;
+    stack_paint();
     int fib_7 = fibonacci_recursive(7, 1);
+    hwm = stack_high_water_mark();
     print_string("Result: fib(7) = ");
     print_number(fib_7);
     print_string("\nMax recursion depth reached: ");
     print_number(max_recursion_depth);
-    print_string("\n\n");
+    print_string("\n");
+    print_stack_peak("fibonacci_recursive(7)", main_sp, hwm);
+    print_string("\n");
     
     // 3. 깊은 함수 호출 체인
     print_string("=== Test 3: Deep Function Call Chain ===\n");
     print_string("Starting deep call chain...\n");
+    stack_paint();
     deep_call_level_1(100);
-    print_string("Deep call chain completed!\n\n");
+    hwm = stack_high_water_mark();
+    print_string("Deep call chain completed!\n");
+    print_stack_peak("deep_call_level_1..5", main_sp, hwm);
+    print_string("\n");
     
     // 4. 스택 오버플로우 시뮬레이션 (안전하게)
     print_string("=== Test 4: Stack Overflow Simulation ===\n");
     print_string("WARNING: Testing stack limits safely...\n");
     stack_overflow_detected = 0;
+    stack_paint();
     dangerous_recursive_function(1);
+    hwm = stack_high_water_mark();
     
     if (stack_overflow_detected) {
         print_string("Stack overflow was safely detected and prevented!\n");
     } else {
         print_string("Function completed without stack overflow.\n");
     }
+    print_stack_peak("dangerous_recursive_function", main_sp, hwm);
+    print_string("Stack region: ");
+    print_hex((unsigned int)__StackLimit);
+    print_string(" - ");
+    print_hex((unsigned int)__StackTop);
+    print_string("\n");
     
     // 최종 스택 상태
     print_string("\n=== Final Stack State ===\n");
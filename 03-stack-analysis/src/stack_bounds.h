@@ -0,0 +1,14 @@
+/*
+ * 재귀 함수의 최대 호출 깊이
+ * main.c 의 안전 장치와 Makefile 의 stack-check(--bound 함수=깊이)가 모두 이 값을 사용
+ * Makefile 이 "#define STACK_BOUND_<함수 이름> <깊이>" 형식을 sed 로 읽으므로 형식을 유지할 것
+ */
+
+#ifndef STACK_BOUNDS_H
+#define STACK_BOUNDS_H
+
+#define STACK_BOUND_factorial_recursive          5   // factorial_recursive(n, 1): 깊이 = n
+#define STACK_BOUND_fibonacci_recursive          16  // 이 깊이에서 더 내려가지 않고 반환
+#define STACK_BOUND_dangerous_recursive_function 21  // 이 깊이에서 SAFETY LIMIT
+
+#endif
@@ -3,6 +3,8 @@
  * 왜 Stack과 Data만으로는 부족한지, Heap의 필요성과 동작 원리
  */
 
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
+
 // ARM Semihosting
 int semihost_call(int reason, void* arg) {
     int result;
@@ -23,45 +25,54 @@ void print_string(const char* str) {
 }
 
 void exit_program(int code) {
-    semihost_call(0x18, &code);
+    // AArch32 SYS_EXIT 는 r1 에 종료 사유를 값으로 받음 (ApplicationExit 이어야 QEMU 종료 코드 0)
+    semihost_call(0x18, (void*)(code == 0 ? 0x20026 : 0x20023));
     while(1);
 }
 
 // 간단한 출력 함수들
 void print_number(int num) {
-    char buffer[20];
-    int i = 0;
-    
-    if (num == 0) {
-        print_string("0");
-        return;
-    }
-    
-    if (num < 0) {
-        print_string("-");
-        num = -num;
+    char buffer[12];
+    int i = 11;
+    unsigned int value = num < 0 ? 0u - (unsigned int)num : (unsigned int)num;
+    
+    buffer[i] = '\0';
+    
+    // 두 자리씩 gen_dec_pairs 에서 복사 (나눗셈 횟수 절반, 출력 호출 1회)
+    while (value >= 100) {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        buffer[--i] = gen_dec_pairs[pair + 1];
+        buffer[--i] = gen_dec_pairs[pair];
     }
-    
-    while (num > 0) {
-        buffer[i++] = '0' + (num % 10);
-        num /= 10;
+    if (value >= 10) {
+        buffer[--i] = gen_dec_pairs[value * 2 + 1];
+        buffer[--i] = gen_dec_pairs[value * 2];
+    } else {
+        buffer[--i] = '0' + value;
     }
     
-    while (i > 0) {
-        char c[2] = {buffer[--i], '\0'};
-        print_string(c);
+    if (num < 0) {
+        buffer[--i] = '-';
     }
+    print_string(&buffer[i]);
 }
 
 void print_hex(unsigned int value) {
-    print_string("0x");
-    char hex_chars[] = "0123456789ABCDEF";
+    char hex_str[11];
     
-    for (int i = 7; i >= 0; i--) {
-        int digit = (value >> (i * 4)) & 0xF;
-        char c[2] = {hex_chars[digit], '\0'};
-        print_string(c);
+    hex_str[0] = '0';
+    hex_str[1] = 'x';
+    
+    // 바이트마다 gen_hex_pairs 에서 두 글자 (매 호출 스택에 표를 만들지 않음)
+    for (int i = 3; i >= 0; i--) {
+        unsigned int pair = (value & 0xFF) * 2;
+        hex_str[2 + i * 2] = gen_hex_pairs[pair];
+        hex_str[3 + i * 2] = gen_hex_pairs[pair + 1];
+        value >>= 8;
     }
+    hex_str[10] = '\0';
+    print_string(hex_str);
 }
 
 // === 간단한 Bump Allocator Heap 구현 ===
@@ -69,11 +80,55 @@ void print_hex(unsigned int value) {
 #define HEAP_SIZE 1024  // 1KB 힙 공간
 
 // BSS 영역에 힙 메모리 할당
-static char heap_memory[HEAP_SIZE];
+// 링커 스크립트가 이 섹션을 32바이트 정렬로 따로 놓고 바로 뒤에 MPU 가드를 붙임 (heap_guard_init)
+static char heap_memory[HEAP_SIZE] __attribute__((section(".bss.heap_arena")));
+static char* heap_base = heap_memory;     // 현재 아레나 시작 (Test 7 은 별도 아레나 사용)
 static char* heap_current = heap_memory;  // 현재 할당 위치
 static int total_allocated = 0;
 static int allocation_count = 0;
 
+// === MPU 힙 가드 (17-mpu 와 같은 PMSAv8 레지스터) ===
+// 아레나 바로 뒤 32바이트(__heap_end ~ __heap_guard_end)를 읽기 전용 + XN 영역으로 설정.
+// 할당받은 블록 끝을 넘어 아레나 밖까지 쓰면 옆 변수를 조용히 덮지 않고 MemManage.
+// 나머지 주소는 PRIVDEFENA 로 기본 메모리 맵을 쓰므로 영역 하나로 끝남 (할당/접근 비용 없음).
+#define MPU_CTRL            (*(volatile unsigned int*)0xE000ED94)
+#define MPU_RNR             (*(volatile unsigned int*)0xE000ED98)
+#define MPU_RBAR            (*(volatile unsigned int*)0xE000ED9C)
+#define MPU_RLAR            (*(volatile unsigned int*)0xE000EDA0)
+#define MPU_MAIR0           (*(volatile unsigned int*)0xE000EDC0)
+#define SCB_SHCSR           (*(volatile unsigned int*)0xE000ED24)
+#define SCB_CFSR            (*(volatile unsigned int*)0xE000ED28)
+#define SCB_MMFAR           (*(volatile unsigned int*)0xE000ED34)
+
+extern char __heap_end[];           // 링커 스크립트에서 정의 (heap_memory 끝)
+extern char __heap_guard_end[];
+
+void heap_guard_init(void) {
+    MPU_CTRL = 0;
+    MPU_MAIR0 = 0xFF;                                   // 속성 0: Normal, write-back
+    MPU_RNR = 0;
+    MPU_RBAR = (unsigned int)__heap_end | (3u << 3)    // SH = inner
+             | (2u << 1) | 1u;                          // AP = RO (특권), XN
+    MPU_RLAR = (((unsigned int)__heap_guard_end - 1) & ~31u) | 1u;  // 속성 0, EN
+    SCB_SHCSR |= 1u << 16;                              // MEMFAULTENA
+    MPU_CTRL = (1u << 2) | 1u;                          // PRIVDEFENA, ENABLE
+    __asm__ volatile ("dsb\n\tisb" : : : "memory");
+}
+
+// MemManage / HardFault (boot.s 벡터): 가드에 쓰기가 닿으면 보고하고 실패로 종료
+void HeapGuard_Handler(void) {
+    unsigned int cfsr = SCB_CFSR;
+    
+    print_string("\n*** MPU heap guard hit: CFSR=");
+    print_hex(cfsr);
+    if (cfsr & (1u << 7)) {                              // MMARVALID
+        print_string(", MMFAR=");
+        print_hex(SCB_MMFAR);
+    }
+    print_string(" ***\n");
+    exit_program(1);
+}
+
 // 메모리 할당 추적을 위한 구조체
 typedef struct {
     void* address;
@@ -84,27 +139,73 @@ typedef struct {
 #define MAX_ALLOCATIONS 20
 static allocation_info_t allocations[MAX_ALLOCATIONS];
 
-// 간단한 malloc 구현 (Bump Allocator)
-void* simple_malloc(int size) {
+// === 인터럽트 안전 모드 ===
+// heap_current / total_allocated / allocations[] 갱신은 읽기-수정-쓰기이므로
+// 도중에 ISR 이 같은 함수를 호출하면 같은 주소를 두 번 내주거나 기록이 사라집니다.
+// HEAP_LOCK=1 (기본): BASEPRI 로 HEAP_CEILING 이하 우선순위 인터럽트를 잠시 가림
+// HEAP_LOCK=0       : 보호 없음 (make HEAP_LOCK=0 - Test 7 에서 경쟁 확인용)
+#ifndef HEAP_LOCK
+#define HEAP_LOCK 1
+#endif
+
+// 힙을 호출하는 ISR 중 가장 높은 우선순위 (숫자가 작을수록 높음)
+// 이보다 높은 ISR 은 heap_alloc 을 쓰면 안 되고 아래의 lock-free 풀만 사용
+#define HEAP_CEILING 0x40
+
+static inline unsigned int heap_lock(void) {
+#if HEAP_LOCK
+    unsigned int key;
+    __asm__ volatile ("mrs %0, basepri" : "=r" (key));
+    // BASEPRI_MAX: 지금보다 더 가리는 경우에만 쓰므로 중첩 호출에도 안전
+    __asm__ volatile ("msr basepri_max, %0" : : "r" (HEAP_CEILING) : "memory");
+    return key;
+#else
+    return 0;
+#endif
+}
+
+static inline void heap_unlock(unsigned int key) {
+#if HEAP_LOCK
+    __asm__ volatile ("msr basepri, %0" : : "r" (key) : "memory");
+#else
+    (void)key;
+#endif
+}
+
+// 할당 핵심부 - 출력 없음, ISR 에서도 호출 가능
+void* heap_alloc(int size) {
     // 8바이트 정렬
     int aligned_size = (size + 7) & ~7;
+    void* ptr = 0;
+    unsigned int key = heap_lock();
     
     // 힙 공간 확인
-    if (heap_current + aligned_size > heap_memory + HEAP_SIZE) {
-        print_string("ERROR: Heap exhausted!\n");
-        return 0;  // NULL
+    if (heap_current + aligned_size <= heap_base + HEAP_SIZE) {
+        ptr = heap_current;
+        heap_current += aligned_size;
+        total_allocated += aligned_size;
+        
+        // 할당 정보 기록
+        if (allocation_count < MAX_ALLOCATIONS) {
+            allocations[allocation_count].address = ptr;
+            allocations[allocation_count].size = aligned_size;
+            allocations[allocation_count].allocation_id = allocation_count + 1;
+            allocation_count++;
+        }
     }
     
-    void* ptr = heap_current;
-    heap_current += aligned_size;
-    total_allocated += aligned_size;
+    heap_unlock(key);
+    return ptr;
+}
+
+// 간단한 malloc 구현 (Bump Allocator)
+void* simple_malloc(int size) {
+    int aligned_size = (size + 7) & ~7;
+    void* ptr = heap_alloc(size);
     
-    // 할당 정보 기록
-    if (allocation_count < MAX_ALLOCATIONS) {
-        allocations[allocation_count].address = ptr;
-        allocations[allocation_count].size = aligned_size;
-        allocations[allocation_count].allocation_id = allocation_count + 1;
-        allocation_count++;
+    if (!ptr) {
+        print_string("ERROR: Heap exhausted!\n");
+        return 0;  // NULL
     }
     
     print_string("  MALLOC: ");
@@ -299,11 +400,343 @@ char* create_string(const char* source) {
     return new_str;
 }
 
+// === 고정 크기 블록 풀 (lock-free, 어떤 우선순위에서도 안전) ===
+// 빈 블록을 단일 연결 스택으로 관리하고 head 를 LDREX/STREX 로 바꿉니다.
+// LDREX 와 STREX 사이에 인터럽트가 들어오면 예외 진입/복귀가 exclusive monitor 를 지워 STREX 가
+// 실패하므로, ISR 이 같은 블록을 꺼냈다가 되돌려 놓아도(ABA) 낡은 next 를 head 로 쓰지 않습니다.
+
+#define POOL_BLOCKS 32
+
+typedef union pool_block {
+    union pool_block* next;     // 비어 있을 때: 다음 빈 블록
+    unsigned int words[4];      // 사용 중: [1] = 소유자, [2] = 블록 주소 (이중 할당 검사용)
+} pool_block_t;
+
+static pool_block_t pool_blocks[POOL_BLOCKS];
+static pool_block_t* volatile pool_head;
+
+void pool_init(void) {
+    for (int i = 0; i < POOL_BLOCKS - 1; i++) {
+        pool_blocks[i].next = &pool_blocks[i + 1];
+    }
+    pool_blocks[POOL_BLOCKS - 1].next = 0;
+    pool_head = &pool_blocks[0];
+}
+
+void* pool_alloc(void) {
+    pool_block_t* head;
+    pool_block_t* next;
+    unsigned int failed;
+    
+    do {
+        __asm__ volatile ("ldrex %0, [%1]" : "=r" (head) : "r" (&pool_head) : "memory");
+        if (!head) {
+            __asm__ volatile ("clrex" : : : "memory");
+            return 0;
+        }
+        next = head->next;
+        __asm__ volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (&pool_head), "r" (next) : "memory");
+    } while (failed);
+    
+    return head;
+}
+
+void pool_free(void* ptr) {
+    pool_block_t* block = (pool_block_t*)ptr;
+    pool_block_t* head;
+    unsigned int failed;
+    
+    do {
+        __asm__ volatile ("ldrex %0, [%1]" : "=r" (head) : "r" (&pool_head) : "memory");
+        block->next = head;
+        __asm__ volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (&pool_head), "r" (block) : "memory");
+    } while (failed);
+}
+
+// === Test 7: 타이머 ISR 과 main 의 동시 할당 ===
+
+#define TIMER0_CTRL      (*(volatile unsigned int*)0x50000000)
+#define TIMER0_RELOAD    (*(volatile unsigned int*)0x50000008)
+#define TIMER0_INTCLEAR  (*(volatile unsigned int*)0x5000000C)
+#define TIMER1_CTRL      (*(volatile unsigned int*)0x50001000)
+#define TIMER1_RELOAD    (*(volatile unsigned int*)0x50001008)
+#define TIMER1_INTCLEAR  (*(volatile unsigned int*)0x5000100C)
+#define NVIC_ISER0       (*(volatile unsigned int*)0xE000E100)
+#define NVIC_ICER0       (*(volatile unsigned int*)0xE000E180)
+#define NVIC_IPR         ((volatile unsigned char*)0xE000E400)
+
+#define STRESS_ROUNDS    100    // 힙을 가득 채웠다가 검증 후 비우는 횟수
+#define STRESS_IRQS      200    // Timer0 인터럽트 최소 횟수
+
+// bump 블록의 첫 워드: 소유자 | 크기 -> 검증 시 아레나를 처음부터 걸어감
+#define OWNER_MAIN       0x4D   // 'M'
+#define OWNER_ISR        0x49   // 'I'
+#define BLOCK_TAG(owner, size)  (((unsigned int)(owner) << 24) | (unsigned int)(size))
+
+typedef struct {
+    pool_block_t* slots[4];     // 들고 있는 블록
+    unsigned int owner;
+    unsigned int turn;
+    unsigned int ops;
+    unsigned int empty;         // 풀이 비어 할당 실패
+    unsigned int corrupt;       // 반납할 때 태그가 바뀌어 있음 = 다른 쪽에도 할당됨
+} pool_user_t;
+
+static pool_user_t pool_main = { .owner = 0x4D41494E };    // "MAIN"
+static pool_user_t pool_tim0 = { .owner = 0x54494D30 };    // "TIM0"
+static pool_user_t pool_tim1 = { .owner = 0x54494D31 };    // "TIM1"
+
+// 슬롯을 하나씩 돌며 비어 있으면 할당, 들고 있으면 태그 확인 후 반납
+static void pool_churn(pool_user_t* user) {
+    unsigned int i = user->turn++ & 3;
+    pool_block_t* block = user->slots[i];
+    
+    if (block) {
+        if (block->words[1] != user->owner || block->words[2] != (unsigned int)block) {
+            user->corrupt++;
+        }
+        user->slots[i] = 0;
+        pool_free(block);
+    } else {
+        block = (pool_block_t*)pool_alloc();
+        if (!block) {
+            user->empty++;
+            return;
+        }
+        block->words[1] = user->owner;
+        block->words[2] = (unsigned int)block;
+        user->slots[i] = block;
+    }
+    user->ops++;
+}
+
+static volatile int isr_bump_bytes;     // 현재 라운드에서 Timer0 가 받은 bump 바이트
+static volatile int isr_bump_allocs;
+static volatile int isr_bump_fails;
+static volatile int timer0_irqs;
+
+// Timer0 (우선순위 0x40 = HEAP_CEILING): bump 힙 + 풀
+void TIMER0_Handler(void) {
+    TIMER0_INTCLEAR = 1;
+    timer0_irqs++;
+    
+    unsigned int* block = (unsigned int*)heap_alloc(8);
+    if (block) {
+        *block = BLOCK_TAG(OWNER_ISR, 8);
+        isr_bump_bytes += 8;
+        isr_bump_allocs++;
+    } else {
+        isr_bump_fails++;
+    }
+    pool_churn(&pool_tim0);
+}
+
+// Timer1 (우선순위 0x00 > HEAP_CEILING): BASEPRI 로 가려지지 않으므로 풀만 사용
+void TIMER1_Handler(void) {
+    TIMER1_INTCLEAR = 1;
+    pool_churn(&pool_tim1);
+}
+
+static void heap_reset(void) {
+    heap_current = heap_base;
+    total_allocated = 0;
+    allocation_count = 0;
+}
+
+// 아레나를 블록 태그로 걸어가며 빈틈/겹침 없이 heap_current 까지 이어지는지 확인
+static int verify_bump_heap(int main_bytes, int isr_bytes) {
+    char* p = heap_base;
+    int seen_main = 0;
+    int seen_isr = 0;
+    
+    while (p < heap_current) {
+        unsigned int tag = *(unsigned int*)p;
+        int size = tag & 0xFFFF;
+        
+        if (size == 0 || (size & 7)) return 0;
+        if ((tag >> 24) == OWNER_MAIN) {
+            seen_main += size;
+        } else if ((tag >> 24) == OWNER_ISR) {
+            seen_isr += size;
+        } else {
+            return 0;
+        }
+        p += size;
+    }
+    
+    return p == heap_current &&
+           seen_main == main_bytes && seen_isr == isr_bytes &&
+           total_allocated == heap_current - heap_base;
+}
+
+// 빈 목록을 걸어가며 블록 수 확인 (범위 밖 / 중복이면 -1)
+static int pool_count_free(void) {
+    unsigned int seen = 0;      // POOL_BLOCKS == 32 -> 블록당 1비트
+    int count = 0;
+    
+    for (pool_block_t* b = pool_head; b; b = b->next) {
+        int index = b - pool_blocks;
+        if (index < 0 || index >= POOL_BLOCKS || (seen & (1u << index))) return -1;
+        seen |= 1u << index;
+        count++;
+    }
+    return count;
+}
+
+static void pool_release_all(pool_user_t* user) {
+    for (int i = 0; i < 4; i++) {
+        if (user->slots[i]) {
+            pool_free(user->slots[i]);
+            user->slots[i] = 0;
+        }
+    }
+}
+
+static void print_pool_user(const char* name, pool_user_t* user) {
+    print_string(name);
+    print_number(user->ops);
+    print_string(" ops, empty ");
+    print_number(user->empty);
+    print_string(", corrupt ");
+    print_number(user->corrupt);
+    print_string("\n");
+}
+
+// Test 7 전용 아레나: Test 1-6 의 할당(문자열, 리스트 등)을 건드리지 않도록
+static char stress_memory[HEAP_SIZE];
+
+typedef struct {
+    char* base;
+    char* current;
+    int total_allocated;
+    int allocation_count;
+    allocation_info_t allocations[MAX_ALLOCATIONS];
+} heap_state_t;
+
+static heap_state_t saved_heap;
+
+static void heap_save(heap_state_t* state) {
+    state->base = heap_base;
+    state->current = heap_current;
+    state->total_allocated = total_allocated;
+    state->allocation_count = allocation_count;
+    for (int i = 0; i < MAX_ALLOCATIONS; i++) {
+        state->allocations[i] = allocations[i];
+    }
+}
+
+static void heap_restore(const heap_state_t* state) {
+    heap_base = state->base;
+    heap_current = state->current;
+    total_allocated = state->total_allocated;
+    allocation_count = state->allocation_count;
+    for (int i = 0; i < MAX_ALLOCATIONS; i++) {
+        allocations[i] = state->allocations[i];
+    }
+}
+
+int heap_stress_test(void) {
+    int rounds = 0;
+    int rounds_ok = 0;
+    int isr_bytes_total = 0;
+    
+    // 타이머를 켜기 전 (아직 ISR 이 힙을 쓰지 않음)
+    heap_save(&saved_heap);
+    heap_base = stress_memory;
+    heap_reset();
+    pool_init();
+    
+    NVIC_IPR[3] = HEAP_CEILING;     // Timer0
+    NVIC_IPR[4] = 0x00;             // Timer1
+    TIMER0_RELOAD = 2500 - 1;       // 25MHz / 2500 = 10kHz
+    TIMER1_RELOAD = 1700 - 1;
+    TIMER0_INTCLEAR = 1;
+    TIMER1_INTCLEAR = 1;
+    NVIC_ISER0 = (1u << 3) | (1u << 4);
+    TIMER0_CTRL = (1u << 3) | (1u << 0);    // IRQ 허용 | 시작
+    TIMER1_CTRL = (1u << 3) | (1u << 0);
+    
+    while (rounds < STRESS_ROUNDS || timer0_irqs < STRESS_IRQS) {
+        int main_bytes = 0;
+        unsigned int* block;
+        
+        // main 도 힙이 찰 때까지 할당 (도중에 Timer0 가 끼어들어 같은 힙에서 할당)
+        while ((block = (unsigned int*)heap_alloc(16)) != 0) {
+            *block = BLOCK_TAG(OWNER_MAIN, 16);
+            main_bytes += 16;
+            pool_churn(&pool_main);
+        }
+        
+        // 검증과 초기화는 Timer0 를 가린 채로 (Timer1 은 계속 풀을 사용)
+        unsigned int key = heap_lock();
+        if (verify_bump_heap(main_bytes, isr_bump_bytes)) {
+            rounds_ok++;
+        }
+        isr_bytes_total += isr_bump_bytes;
+        isr_bump_bytes = 0;
+        heap_reset();
+        heap_unlock(key);
+        
+        for (int i = 0; i < 16; i++) {
+            pool_churn(&pool_main);
+        }
+        rounds++;
+    }
+    
+    TIMER0_CTRL = 0;
+    TIMER1_CTRL = 0;
+    NVIC_ICER0 = (1u << 3) | (1u << 4);
+    heap_restore(&saved_heap);
+    
+    pool_release_all(&pool_main);
+    pool_release_all(&pool_tim0);
+    pool_release_all(&pool_tim1);
+    int pool_free_blocks = pool_count_free();
+    int corrupt = pool_main.corrupt + pool_tim0.corrupt + pool_tim1.corrupt;
+    
+    print_string("Mode: HEAP_LOCK=");
+    print_number(HEAP_LOCK);
+    print_string(HEAP_LOCK ? " (BASEPRI ceiling 0x40)\n" : " (no protection)\n");
+    print_string("Bump heap rounds verified: ");
+    print_number(rounds_ok);
+    print_string(" / ");
+    print_number(rounds);
+    print_string("\n");
+    print_string("Timer0 bump allocs: ");
+    print_number(isr_bump_allocs);
+    print_string(" (");
+    print_number(isr_bytes_total);
+    print_string(" bytes, ");
+    print_number(isr_bump_fails);
+    print_string(" failed on full heap)\n");
+    print_pool_user("Pool main  : ", &pool_main);
+    print_pool_user("Pool Timer0: ", &pool_tim0);
+    print_pool_user("Pool Timer1: ", &pool_tim1);
+    print_string("Pool free blocks at end: ");
+    print_number(pool_free_blocks);
+    print_string(" / ");
+    print_number(POOL_BLOCKS);
+    print_string("\n");
+    
+    int ok = rounds_ok == rounds && corrupt == 0 && pool_free_blocks == POOL_BLOCKS &&
+             pool_tim0.ops > 0 && pool_tim1.ops > 0;
+    print_string(ok ? "Result: PASS\n" : "Result: FAIL\n");
+    return ok;
+}
+
 void main(void) {
     print_string("===============================================\n");
     print_string("Simple Heap Implementation - Why We Need Heap\n");
     print_string("===============================================\n");
     
+    // 아레나 밖으로 넘친 쓰기는 옆 변수를 덮지 않고 MemManage
+    heap_guard_init();
+    print_string("MPU heap guard (write -> MemManage): ");
+    print_hex((unsigned int)__heap_end);
+    print_string(" - ");
+    print_hex((unsigned int)__heap_guard_end);
+    print_string("\n");
+    
     // 초기 힙 상태
     print_heap_status();
     
@@ -403,6 +836,14 @@ void main(void) {
     
     print_heap_status();
     
+    // 7. 인터럽트 동시 할당 테스트
+    print_string("=== Test 7: Interrupt-Safe Allocation ===\n");
+    print_string("Timer0/Timer1 ISRs allocate while main allocates...\n");
+    int stress_ok = heap_stress_test();
+    
+    // Test 7 은 별도 아레나를 쓰므로 Test 6 직후와 같은 상태여야 함
+    print_heap_status();
+    
     // 최종 분석
     print_string("\n=== Analysis: Why We Need Heap ===\n");
     print_string("1. Stack: Limited size, automatic management, LIFO order\n");
@@ -413,10 +854,17 @@ void main(void) {
     print_string("- Memory allocation based on runtime decisions\n");
     print_string("- Data that outlives the function that created it\n");
     print_string("- Complex data structures (trees, graphs, etc.)\n");
+    print_string("\nFrom interrupts:\n");
+    print_string("- BASEPRI critical section: fast, but only up to HEAP_CEILING\n");
+    print_string("- LDREX/STREX block pool: fixed size, safe from any priority\n");
     
     print_string("\n===============================================\n");
     print_string("Heap implementation analysis completed!\n");
     print_string("===============================================\n");
     
+    if (!stress_ok) {
+        print_string("Test 7 FAILED\n");
+        exit_program(1);
+    }
     exit_program(0);
 }
\ No newline at end of file
@@ -1,3 +1,8 @@
+/*
+ * 표준 스타트업: .data 복사, .bss 초기화 후 main 진입
+ * (최소 초기화 버전은 boot_fast.s - make FAST_BOOT=1)
+ */
+
     .syntax unified
     .thumb
 
@@ -9,12 +14,62 @@
     .thumb_func
     .global Reset_Handler
 Reset_Handler:
+    /* 부팅 사이클 측정 시작: SysTick을 프로세서 클럭으로 자유 실행 */
+    ldr     r0, =0xE000E010          /* SYST_CSR */
+    ldr     r1, =0x00FFFFFF
+    str     r1, [r0, #4]             /* SYST_RVR = 최대값 */
+    str     r1, [r0, #8]             /* SYST_CVR 쓰기 = 0으로 클리어 */
+    movs    r1, #5                   /* CLKSOURCE=프로세서 클럭, ENABLE */
+    str     r1, [r0]
+
     /* 스택 포인터 설정 */
     ldr r0, =__StackTop
     mov sp, r0
+
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
     
+    /* main 직전: __boot_cycles = 0xFFFFFF - SYST_CVR, SysTick 정지 */
+    ldr     r0, =0xE000E010
+    ldr     r1, [r0, #8]
+    movs    r2, #0
+    str     r2, [r0]
+    ldr     r2, =0x00FFFFFF
+    subs    r1, r2, r1
+    ldr     r2, =__boot_cycles
+    str     r1, [r2]
+
     /* main 함수 호출 */
     bl main
     
 hang:
     b hang
+
+/* 리셋부터 main 진입까지 걸린 사이클 (GDB: x/wx &__boot_cycles) */
+    .bss
+    .align  2
+    .global __boot_cycles
+__boot_cycles:
+    .space  4
@@ -0,0 +1,183 @@
+/*
+ * 분기 없는(branchless) 기본 연산
+ *
+ * IT 블록 규칙: CMP 와 IT/조건부 명령은 반드시 "하나의" asm 문 안에 둡니다.
+ * asm 문을 나누면 컴파일러가 그 사이에 플래그를 바꾸는 명령을 넣거나
+ * 순서를 바꿀 수 있어 결과가 보장되지 않습니다 (출력 피연산자도 조건부로만
+ * 쓰이므로 "+r" 로 기존 값을 유지해야 합니다).
+ *
+ * SEL 규칙: USUB8/SSUB16 이 레인별로 설정한 GE 플래그를 SEL 이 읽으므로
+ * 두 명령어도 하나의 asm 문 안에 둡니다.
+ *
+ * 비교용 분기 버전(_branchy)은 실제 분기 명령(B<cond>)을 쓰도록 asm 으로 고정합니다.
+ * C 로 쓰면 -O2 에서 컴파일러가 스스로 IT 블록으로 바꿔 버리기 때문입니다.
+ */
+
+#ifndef BRANCHLESS_H
+#define BRANCHLESS_H
+
+#include <stdint.h>
+
+// ========== IT 블록 기반 (스칼라) ==========
+
+static inline int32_t bl_min(int32_t a, int32_t b)
+{
+    __asm__ ("cmp   %0, %1\n\t"
+             "it    gt\n\t"
+             "movgt %0, %1"
+             : "+r" (a) : "r" (b) : "cc");
+    return a;
+}
+
+static inline int32_t bl_max(int32_t a, int32_t b)
+{
+    __asm__ ("cmp   %0, %1\n\t"
+             "it    lt\n\t"
+             "movlt %0, %1"
+             : "+r" (a) : "r" (b) : "cc");
+    return a;
+}
+
+/* lo <= hi 가정 */
+static inline int32_t bl_clamp(int32_t x, int32_t lo, int32_t hi)
+{
+    __asm__ ("cmp   %0, %1\n\t"
+             "it    lt\n\t"
+             "movlt %0, %1\n\t"
+             "cmp   %0, %2\n\t"
+             "it    gt\n\t"
+             "movgt %0, %2"
+             : "+r" (x) : "r" (lo), "r" (hi) : "cc");
+    return x;
+}
+
+/* abs(INT32_MIN) = INT32_MIN (C 의 abs 와 같은 2의 보수 동작) */
+static inline int32_t bl_abs(int32_t x)
+{
+    __asm__ ("cmp   %0, #0\n\t"
+             "it    lt\n\t"
+             "rsblt %0, %0, #0"
+             : "+r" (x) : : "cc");
+    return x;
+}
+
+/* cond != 0 ? a : b */
+static inline int32_t bl_select(int32_t cond, int32_t a, int32_t b)
+{
+    __asm__ ("cmp   %1, #0\n\t"
+             "it    ne\n\t"
+             "movne %0, %2"
+             : "+r" (b) : "r" (cond), "r" (a) : "cc");
+    return b;
+}
+
+// ========== SEL + GE 플래그 기반 (패킹 레인) ==========
+
+/* 바이트 4개 각각의 부호 없는 최댓값: USUB8 이 a >= b 인 레인에 GE 설정 */
+static inline uint32_t bl_max_u8x4(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm__ ("usub8 %0, %1, %2\n\t"
+             "sel   %0, %1, %2"
+             : "=&r" (r) : "r" (a), "r" (b) : "cc");
+    return r;
+}
+
+static inline uint32_t bl_min_u8x4(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm__ ("usub8 %0, %1, %2\n\t"
+             "sel   %0, %2, %1"
+             : "=&r" (r) : "r" (a), "r" (b) : "cc");
+    return r;
+}
+
+/* 16비트 2개 각각의 부호 있는 최댓값/최솟값: SSUB16 이 a - b >= 0 인 레인에 GE 설정 */
+static inline uint32_t bl_max_s16x2(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm__ ("ssub16 %0, %1, %2\n\t"
+             "sel    %0, %1, %2"
+             : "=&r" (r) : "r" (a), "r" (b) : "cc");
+    return r;
+}
+
+static inline uint32_t bl_min_s16x2(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm__ ("ssub16 %0, %1, %2\n\t"
+             "sel    %0, %2, %1"
+             : "=&r" (r) : "r" (a), "r" (b) : "cc");
+    return r;
+}
+
+/* 바이트 4개를 각각 [lo, hi] 로 제한 */
+static inline uint32_t bl_clamp_u8x4(uint32_t x, uint32_t lo, uint32_t hi)
+{
+    return bl_min_u8x4(bl_max_u8x4(x, lo), hi);
+}
+
+// ========== 비교용 분기 버전 ==========
+
+static inline int32_t branchy_min(int32_t a, int32_t b)
+{
+    __asm__ ("cmp   %0, %1\n\t"
+             "ble   1f\n\t"
+             "mov   %0, %1\n"
+             "1:"
+             : "+r" (a) : "r" (b) : "cc");
+    return a;
+}
+
+static inline int32_t branchy_clamp(int32_t x, int32_t lo, int32_t hi)
+{
+    __asm__ ("cmp   %0, %1\n\t"
+             "bge   1f\n\t"
+             "mov   %0, %1\n\t"
+             "b     2f\n"
+             "1:\n\t"
+             "cmp   %0, %2\n\t"
+             "ble   2f\n\t"
+             "mov   %0, %2\n"
+             "2:"
+             : "+r" (x) : "r" (lo), "r" (hi) : "cc");
+    return x;
+}
+
+static inline int32_t branchy_abs(int32_t x)
+{
+    __asm__ ("cmp   %0, #0\n\t"
+             "bge   1f\n\t"
+             "rsb   %0, %0, #0\n"
+             "1:"
+             : "+r" (x) : : "cc");
+    return x;
+}
+
+static inline int32_t branchy_select(int32_t cond, int32_t a, int32_t b)
+{
+    __asm__ ("cbz   %1, 1f\n\t"
+             "mov   %0, %2\n"
+             "1:"
+             : "+r" (b) : "l" (cond), "r" (a) : "cc");
+    return b;
+}
+
+/* 바이트별 비교 분기 4회 */
+static inline uint32_t branchy_max_u8x4(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t x = (a >> shift) & 0xFF;
+        uint32_t y = (b >> shift) & 0xFF;
+        __asm__ ("cmp   %0, %1\n\t"
+                 "bhs   1f\n\t"
+                 "mov   %0, %1\n"
+                 "1:"
+                 : "+r" (x) : "r" (y) : "cc");
+        r |= x << shift;
+    }
+    return r;
+}
+
+#endif /* BRANCHLESS_H */
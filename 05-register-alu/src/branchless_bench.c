@@ -0,0 +1,148 @@
+/*
+ * 분기 버전 vs 분기 없는 버전 벤치마크
+ *
+ * 비교 결과가 무작위(LCG)인 데이터와 항상 같은 쪽인(정렬된) 데이터에서
+ * 같은 연산을 분기 버전과 IT/SEL 버전으로 실행해 사이클을 비교합니다.
+ * 두 버전의 결과가 같은지도 함께 검사합니다.
+ */
+
+#include <stdint.h>
+#include "branchless.h"
+#include "dwt.h"
+
+#define N 256
+
+int print_string(const char *str);
+void print_hex(unsigned int value);
+
+static int32_t in_a[N], in_b[N], in_cond[N];
+static uint32_t in_u8a[N], in_u8b[N];
+static int32_t out_branchy[N], out_branchless[N];
+static uint32_t lcg_state = 0x1234567;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void print_dec(uint32_t value, int width) {
+    char buffer[12];
+    int i = 11;
+    
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+        width--;
+    } while (value > 0 && i > 0);
+    while (width-- > 0 && i > 0) {
+        buffer[--i] = ' ';
+    }
+    print_string(&buffer[i]);
+}
+
+/* random = 1: 비교 결과가 무작위, 0: 항상 a <= b (분기 예측이 쉬운 경우) */
+static void fill(int random) {
+    for (int i = 0; i < N; i++) {
+        int32_t x = (int32_t)(lcg_next() >> 20) - 2048;   /* [-2048, 2047] */
+        int32_t y = (int32_t)(lcg_next() >> 20) - 2048;
+        if (!random) {
+            x = i - N;
+            y = i;
+        }
+        in_a[i] = x;
+        in_b[i] = y;
+        in_cond[i] = random ? (int32_t)(lcg_next() >> 31) : 1;
+        in_u8a[i] = random ? lcg_next() : 0x01010101u * (i & 0x7F);
+        in_u8b[i] = random ? lcg_next() : 0x80808080u;
+    }
+}
+
+/* 분기 버전과 분기 없는 버전을 같은 루프 모양으로 측정 */
+#define MEASURE(cycles, out, expr)                  \
+    do {                                            \
+        uint32_t start_ = dwt_cycles();             \
+        for (int i = 0; i < N; i++) {               \
+            out[i] = (expr);                        \
+        }                                           \
+        (cycles) = dwt_elapsed(start_);             \
+    } while (0)
+
+static int same(void) {
+    for (int i = 0; i < N; i++) {
+        if (out_branchy[i] != out_branchless[i]) return 0;
+    }
+    return 1;
+}
+
+static int failures;
+
+static void print_row(const char *name, uint32_t branchy, uint32_t branchless) {
+    int ok = same();
+    
+    print_string(name);
+    print_dec(branchy, 10);
+    print_dec(branchless, 12);
+    print_string(ok ? "   OK\n" : "   MISMATCH\n");
+    if (!ok) failures++;
+}
+
+static void run_suite(void) {
+    uint32_t c1, c2;
+    
+    MEASURE(c1, out_branchy, branchy_min(in_a[i], in_b[i]));
+    MEASURE(c2, out_branchless, bl_min(in_a[i], in_b[i]));
+    print_row("  min        (IT)   ", c1, c2);
+    
+    MEASURE(c1, out_branchy, branchy_clamp(in_a[i], -1000, 1000));
+    MEASURE(c2, out_branchless, bl_clamp(in_a[i], -1000, 1000));
+    print_row("  clamp      (IT x2)", c1, c2);
+    
+    MEASURE(c1, out_branchy, branchy_abs(in_a[i]));
+    MEASURE(c2, out_branchless, bl_abs(in_a[i]));
+    print_row("  abs        (IT)   ", c1, c2);
+    
+    MEASURE(c1, out_branchy, branchy_select(in_cond[i], in_a[i], in_b[i]));
+    MEASURE(c2, out_branchless, bl_select(in_cond[i], in_a[i], in_b[i]));
+    print_row("  select     (IT)   ", c1, c2);
+    
+    MEASURE(c1, out_branchy, (int32_t)branchy_max_u8x4(in_u8a[i], in_u8b[i]));
+    MEASURE(c2, out_branchless, (int32_t)bl_max_u8x4(in_u8a[i], in_u8b[i]));
+    print_row("  max_u8x4   (SEL)  ", c1, c2);
+}
+
+/* 기대값을 아는 몇 가지 경계 사례 */
+static int check_edges(void) {
+    int ok = 1;
+    
+    ok &= bl_min(-5, 3) == -5 && bl_max(-5, 3) == 3;
+    ok &= bl_clamp(5000, -1000, 1000) == 1000 && bl_clamp(-5000, -1000, 1000) == -1000;
+    ok &= bl_abs(-7) == 7 && bl_abs((int32_t)0x80000000) == (int32_t)0x80000000;
+    ok &= bl_select(0, 1, 2) == 2 && bl_select(-1, 1, 2) == 1;
+    ok &= bl_max_u8x4(0x10FF0080u, 0x20017F7Fu) == 0x20FF7F80u;
+    ok &= bl_min_u8x4(0x10FF0080u, 0x20017F7Fu) == 0x1001007Fu;
+    ok &= bl_max_s16x2(0x8000FFFFu, 0x00010000u) == 0x00010000u;   /* -32768 vs 1, -1 vs 0 */
+    ok &= bl_min_s16x2(0x8000FFFFu, 0x00010000u) == 0x8000FFFFu;
+    ok &= bl_clamp_u8x4(0x00FF8040u, 0x20202020u, 0xC0C0C0C0u) == 0x20C08040u;
+    return ok;
+}
+
+void branchless_benchmark(void) {
+    print_string("=== 분기 vs 분기 없는 연산 벤치마크 ===\n");
+    dwt_init();
+    print_string(dwt_use_timer ? "사이클 소스: Dual Timer 1 (QEMU)\n" : "사이클 소스: DWT CYCCNT\n");
+    
+    asm volatile ("nop"); // Breakpoint 24: 경계 사례 검사
+    print_string(check_edges() ? "경계 사례: OK\n" : "경계 사례: MISMATCH\n");
+    
+    print_string("kernel (N=256)          branchy   branchless\n");
+    print_string("[무작위 비교 결과]\n");
+    fill(1);
+    run_suite();
+    
+    print_string("[항상 같은 비교 결과]\n");
+    fill(0);
+    run_suite();
+    
+    print_string(failures ? "결과 불일치 발견!\n" : "분기/분기 없는 버전 결과 일치\n");
+}
@@ -3,6 +3,11 @@
  * 다양한 연산을 통해 레지스터 상태 변화를 관찰
  */
 
+#include "branchless.h"
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
+
+void branchless_benchmark(void);
+
 // Semihosting을 위한 함수 선언
 int print_string(const char *str) {
     register int r0 asm("r0");
@@ -17,11 +22,13 @@ int print_string(const char *str) {
 
 void print_hex(unsigned int value) {
     char hex_str[12] = "0x00000000\n";
-    const char hex_chars[] = "0123456789ABCDEF";
     
-    for (int i = 7; i >= 0; i--) {
-        hex_str[2 + i] = hex_chars[value & 0xF];
-        value >>= 4;
+    // 바이트마다 gen_hex_pairs 에서 두 글자 (매 호출 스택에 표를 만들지 않음)
+    for (int i = 3; i >= 0; i--) {
+        unsigned int pair = (value & 0xFF) * 2;
+        hex_str[2 + i * 2] = gen_hex_pairs[pair];
+        hex_str[3 + i * 2] = gen_hex_pairs[pair + 1];
+        value >>= 8;
     }
     
     print_string(hex_str);
@@ -100,23 +107,28 @@ void register_demo_conditional(void) {
     
     asm volatile ("nop"); // Breakpoint 14: 초기값 확인
     
-    // 비교 연산 (CPSR 플래그 설정)
+    // 비교 연산 (CPSR 플래그 설정) - 플래그 관찰용
     asm volatile ("cmp %0, %1" : : "r"(a), "r"(b) : "cc");
     asm volatile ("nop"); // Breakpoint 15: CMP 후 플래그 확인
     
     // 조건부 실행 (GT: Greater Than) - IT 블록 사용
-    asm volatile ("it gt");
-    asm volatile ("movgt %0, #1" : "=r"(result) : : "cc");
+    // CMP, IT, 조건부 명령은 반드시 하나의 asm 문 안에 있어야 함:
+    // asm 문을 나누면 컴파일러가 그 사이에 플래그를 바꾸는 명령을 넣을 수 있음
+    asm volatile ("cmp   %1, %2\n\t"
+                  "ite   gt\n\t"
+                  "movgt %0, #1\n\t"
+                  "movle %0, #0"
+                  : "=r"(result) : "r"(a), "r"(b) : "cc");
     asm volatile ("nop"); // Breakpoint 16: 조건부 실행 결과 확인
     
     // 값 교체해서 다시 테스트
     a = 30;
     b = 70;
-    asm volatile ("cmp %0, %1" : : "r"(a), "r"(b) : "cc");
-    asm volatile ("it gt");
-    asm volatile ("movgt %0, #1" : "=r"(result) : : "cc");
-    asm volatile ("it le");
-    asm volatile ("movle %0, #0" : "=r"(result) : : "cc");
+    asm volatile ("cmp   %1, %2\n\t"
+                  "ite   gt\n\t"
+                  "movgt %0, #1\n\t"
+                  "movle %0, #0"
+                  : "=r"(result) : "r"(a), "r"(b) : "cc");
     asm volatile ("nop"); // Breakpoint 17: 두 번째 조건부 실행 결과
 }
 
@@ -145,6 +157,26 @@ void register_demo_stack_operations(void) {
     asm volatile ("nop"); // Breakpoint 21: 팝 후 복원된 값 확인
 }
 
+void register_demo_branchless(void) {
+    print_string("=== 분기 없는 연산 (IT 블록 / SEL) 데모 ===\n");
+    
+    register int result asm("r2");
+    
+    // IT 블록: 비교 결과에 따라 MOV 가 실행되거나 NOP 처럼 건너뜀 (분기 없음)
+    result = bl_clamp(1500, -1000, 1000);
+    asm volatile ("nop"); // Breakpoint 22: clamp 결과 (0x3E8 = 1000)
+    
+    // SEL: USUB8 이 바이트별 GE 플래그(xPSR[19:16])를 설정, SEL 이 바이트별 선택
+    result = (int)bl_max_u8x4(0x10FF0080, 0x20017F7F);
+    asm volatile ("nop"); // Breakpoint 23: 바이트별 최댓값 (0x20FF7F80)
+    
+    print_string("clamp(1500, -1000, 1000) = ");
+    print_hex(bl_clamp(1500, -1000, 1000));
+    print_string("max_u8x4(0x10FF0080, 0x20017F7F) = ");
+    print_hex(bl_max_u8x4(0x10FF0080, 0x20017F7F));
+    (void)result;
+}
+
 int main(void) {
     print_string("Cortex-M33 Register & ALU Demo\n");
     print_string("===============================\n");
@@ -155,6 +187,8 @@ int main(void) {
     register_demo_shift();
     register_demo_conditional();
     register_demo_stack_operations();
+    register_demo_branchless();
+    branchless_benchmark();
     
     print_string("모든 레지스터 데모 완료!\n");
     
@@ -0,0 +1,65 @@
+/*
+ * Fast-Boot Startup (make FAST_BOOT=1)
+ *
+ * 테스트 팜처럼 수천 번 리셋하는 환경을 위한 최소 초기화 경로:
+ *  - SP 재설정 생략: 하드웨어가 리셋 시 벡터[0]에서 MSP를 이미 로드함
+ *  - .data 복사 생략: .data 는 로드 이미지(ELF 또는 build/*-data.bin)에
+ *    초기값이 들어 있는 RAM 스냅샷으로 미리 적재됨
+ *  - .bss 는 16바이트(4워드) 단위 한 루프로 0 채움 (링커가 크기를 16의 배수로 맞춤)
+ *  - 그 외 모든 부가 작업(스택 페인팅 등) 생략
+ * 표준 스타트업(boot.s)과 같은 방법으로 __boot_cycles 에 리셋~main 사이클을 기록합니다.
+ */
+
+    .syntax unified
+    .thumb
+
+    .section .isr_vector
+    .long   __StackTop           /* MSP initial value */
+    .long   Reset_Handler        /* Reset Handler */
+
+    .text
+    .thumb_func
+    .global Reset_Handler
+Reset_Handler:
+    /* 부팅 사이클 측정 시작: SysTick을 프로세서 클럭으로 자유 실행 */
+    ldr     r0, =0xE000E010          /* SYST_CSR */
+    ldr     r1, =0x00FFFFFF
+    str     r1, [r0, #4]             /* SYST_RVR = 최대값 */
+    str     r1, [r0, #8]             /* SYST_CVR 쓰기 = 0으로 클리어 */
+    movs    r1, #5                   /* CLKSOURCE=프로세서 클럭, ENABLE */
+    str     r1, [r0]
+
+    /* .bss 0 채우기: STMIA 한 번에 16바이트 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+    movs    r3, #0
+    movs    r4, #0
+    movs    r5, #0
+    b       zero_check
+zero_bss:
+    stmia   r0!, {r2-r5}
+zero_check:
+    cmp     r0, r1
+    blo     zero_bss
+
+    /* main 직전: __boot_cycles = 0xFFFFFF - SYST_CVR, SysTick 정지 */
+    ldr     r0, =0xE000E010
+    ldr     r1, [r0, #8]
+    str     r2, [r0]                 /* r2 = 0 */
+    ldr     r2, =0x00FFFFFF
+    subs    r1, r2, r1
+    ldr     r2, =__boot_cycles
+    str     r1, [r2]
+
+    bl      main
+
+hang:
+    b       hang
+
+/* 리셋부터 main 진입까지 걸린 사이클 (GDB: x/wx &__boot_cycles) */
+    .bss
+    .align  2
+    .global __boot_cycles
+__boot_cycles:
+    .space  4
@@ -4,6 +4,7 @@
  */
 
 #include <stdint.h>
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
 
 // Semihosting을 위한 함수 선언
 int print_string(const char *str) {
@@ -19,11 +20,13 @@ int print_string(const char *str) {
 
 void print_hex(unsigned int value) {
     char hex_str[12] = "0x00000000\n";
-    const char hex_chars[] = "0123456789ABCDEF";
     
-    for (int i = 7; i >= 0; i--) {
-        hex_str[2 + i] = hex_chars[value & 0xF];
-        value >>= 4;
+    // 바이트마다 gen_hex_pairs 에서 두 글자 (매 호출 스택에 표를 만들지 않음)
+    for (int i = 3; i >= 0; i--) {
+        unsigned int pair = (value & 0xFF) * 2;
+        hex_str[2 + i * 2] = gen_hex_pairs[pair];
+        hex_str[3 + i * 2] = gen_hex_pairs[pair + 1];
+        value >>= 8;
     }
     
     print_string(hex_str);
@@ -0,0 +1,174 @@
+/*
+ * DSP/SIMD 커널 구현
+ *
+ * ACLE(<arm_acle.h>) 내장 함수는 DSP 명령어 하나로 그대로 번역됩니다.
+ *   __sadd16  -> SADD16  (2 x 16비트 덧셈, 랩어라운드)
+ *   __qadd16  -> QADD16  (2 x 16비트 포화 덧셈)
+ *   __uqadd8  -> UQADD8  (4 x 8비트 부호 없는 포화 덧셈)
+ *   __smlald  -> SMLALD  (2 x 16비트 곱의 합을 64비트 누산기에)
+ *   __ssat    -> SSAT    (부호 있는 포화)
+ * 메모리 접근은 32비트 단위로 묶어 LDR 하나가 레인 2개(또는 4개)를 가져옵니다.
+ */
+
+#include <arm_acle.h>
+#include "dsp_kernels.h"
+
+#if !defined(__ARM_FEATURE_SIMD32) || !__ARM_FEATURE_SIMD32
+#error "DSP 확장이 필요합니다 (-mcpu=cortex-m33, +nodsp 금지)"
+#endif
+
+/* 정렬을 가정하지 않는 32비트 로드/스토어 (Cortex-M33은 비정렬 LDR/STR 지원) */
+static inline uint32_t load32(const void *p)
+{
+    uint32_t v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void store32(void *p, uint32_t v)
+{
+    __builtin_memcpy(p, &v, sizeof(v));
+}
+
+static inline int16_t sat16(int32_t v)
+{
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return (int16_t)v;
+}
+
+// ========== 벡터 덧셈 ==========
+
+void vec_add_q15_scalar(int16_t *dst, const int16_t *a, const int16_t *b, int n)
+{
+    for (int i = 0; i < n; i++) {
+        dst[i] = (int16_t)(a[i] + b[i]);
+    }
+}
+
+void vec_add_q15_simd(int16_t *dst, const int16_t *a, const int16_t *b, int n)
+{
+    for (int i = 0; i < n; i += 2) {
+        int16x2_t va = (int16x2_t)load32(&a[i]);
+        int16x2_t vb = (int16x2_t)load32(&b[i]);
+        store32(&dst[i], (uint32_t)__sadd16(va, vb));
+    }
+}
+
+void vec_add_sat_q15_scalar(int16_t *dst, const int16_t *a, const int16_t *b, int n)
+{
+    for (int i = 0; i < n; i++) {
+        dst[i] = sat16((int32_t)a[i] + b[i]);
+    }
+}
+
+void vec_add_sat_q15_simd(int16_t *dst, const int16_t *a, const int16_t *b, int n)
+{
+    for (int i = 0; i < n; i += 2) {
+        int16x2_t va = (int16x2_t)load32(&a[i]);
+        int16x2_t vb = (int16x2_t)load32(&b[i]);
+        store32(&dst[i], (uint32_t)__qadd16(va, vb));
+    }
+}
+
+void vec_add_sat_u8_scalar(uint8_t *dst, const uint8_t *a, const uint8_t *b, int n)
+{
+    for (int i = 0; i < n; i++) {
+        unsigned int sum = a[i] + b[i];
+        dst[i] = sum > 255 ? 255 : (uint8_t)sum;
+    }
+}
+
+void vec_add_sat_u8_simd(uint8_t *dst, const uint8_t *a, const uint8_t *b, int n)
+{
+    for (int i = 0; i < n; i += 4) {
+        uint8x4_t va = (uint8x4_t)load32(&a[i]);
+        uint8x4_t vb = (uint8x4_t)load32(&b[i]);
+        store32(&dst[i], (uint32_t)__uqadd8(va, vb));
+    }
+}
+
+// ========== 내적 ==========
+
+int64_t dot_q15_scalar(const int16_t *a, const int16_t *b, int n)
+{
+    int64_t acc = 0;
+    for (int i = 0; i < n; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return acc;
+}
+
+int64_t dot_q15_simd(const int16_t *a, const int16_t *b, int n)
+{
+    /* SMLALD: 64비트 누산이므로 n이 커도 오버플로 없음 */
+    uint64_t acc = 0;
+    for (int i = 0; i < n; i += 2) {
+        acc = __smlald((int16x2_t)load32(&a[i]), (int16x2_t)load32(&b[i]), acc);
+    }
+    return (int64_t)acc;
+}
+
+// ========== FIR 필터 ==========
+
+void fir_q15_scalar(int16_t *y, const int16_t *x, const int16_t *h, int n)
+{
+    for (int i = 0; i < n; i++) {
+        int64_t acc = 0;
+        for (int k = 0; k < FIR_TAPS; k++) {
+            acc += (int32_t)h[k] * x[i + FIR_TAPS - 1 - k];
+        }
+        y[i] = sat16((int32_t)(acc >> 15));
+    }
+}
+
+void fir_q15_simd(int16_t *y, const int16_t *x, const int16_t *h_rev, int n)
+{
+    /*
+     * 계수를 뒤집어 두면 x 와 h_rev 가 같은 방향으로 증가하므로
+     * 두 샘플/두 계수를 한 번에 읽어 SMLALD 한 번에 곱셈 2개를 누산합니다.
+     */
+    for (int i = 0; i < n; i++) {
+        const int16_t *xp = &x[i];
+        uint64_t acc = 0;
+        for (int k = 0; k < FIR_TAPS; k += 2) {
+            acc = __smlald((int16x2_t)load32(&xp[k]), (int16x2_t)load32(&h_rev[k]), acc);
+        }
+        y[i] = (int16_t)__ssat((int32_t)((int64_t)acc >> 15), 16);
+    }
+}
+
+// ========== 바이트 히스토그램 ==========
+
+void histogram_u8_scalar(uint32_t *hist, const uint8_t *data, int n)
+{
+    for (int i = 0; i < n; i++) {
+        hist[data[i]]++;
+    }
+}
+
+void histogram_u8_simd(uint32_t *hist, const uint8_t *data, int n)
+{
+    /*
+     * 히스토그램을 한 번에 처리하는 SIMD 명령어는 없습니다 (scatter 불가).
+     * 대신 워드 로드 1회로 4바이트를 가져와 UXTB(회전 포함)로 꺼내고,
+     * 하위 히스토그램 2개에 번갈아 누적해 같은 칸을 연속으로 갱신할 때의
+     * load-use 의존성을 끊습니다.
+     */
+    static uint32_t sub[2][256];
+
+    for (int i = 0; i < 256; i++) {
+        sub[0][i] = 0;
+        sub[1][i] = 0;
+    }
+    for (int i = 0; i < n; i += 4) {
+        uint32_t w = load32(&data[i]);
+        sub[0][w & 0xFF]++;
+        sub[1][(w >> 8) & 0xFF]++;
+        sub[0][(w >> 16) & 0xFF]++;
+        sub[1][w >> 24]++;
+    }
+    for (int i = 0; i < 256; i++) {
+        hist[i] += sub[0][i] + sub[1][i];
+    }
+}
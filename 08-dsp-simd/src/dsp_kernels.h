@@ -0,0 +1,44 @@
+/*
+ * DSP/SIMD 커널 - ACLE 패킹 산술 버전과 스칼라 쌍둥이
+ *
+ * Cortex-M33 DSP 확장은 32비트 레지스터 하나를 2 x 16비트 또는 4 x 8비트
+ * 레인으로 나누어 한 명령어로 처리합니다 (SADD16, QADD16, UQADD8, SMLALD ...).
+ * 모든 커널은 같은 결과를 내는 스칼라 버전(_scalar)과 짝을 이룹니다.
+ */
+
+#ifndef DSP_KERNELS_H
+#define DSP_KERNELS_H
+
+#include <stdint.h>
+
+#define FIR_TAPS 16
+
+/* dst[i] = a[i] + b[i] (16비트 랩어라운드), n은 짝수 */
+void vec_add_q15_scalar(int16_t *dst, const int16_t *a, const int16_t *b, int n);
+void vec_add_q15_simd(int16_t *dst, const int16_t *a, const int16_t *b, int n);
+
+/* dst[i] = sat16(a[i] + b[i]), n은 짝수 */
+void vec_add_sat_q15_scalar(int16_t *dst, const int16_t *a, const int16_t *b, int n);
+void vec_add_sat_q15_simd(int16_t *dst, const int16_t *a, const int16_t *b, int n);
+
+/* dst[i] = min(a[i] + b[i], 255), n은 4의 배수 */
+void vec_add_sat_u8_scalar(uint8_t *dst, const uint8_t *a, const uint8_t *b, int n);
+void vec_add_sat_u8_simd(uint8_t *dst, const uint8_t *a, const uint8_t *b, int n);
+
+/* sum(a[i] * b[i]) - 64비트 누산, n은 짝수 */
+int64_t dot_q15_scalar(const int16_t *a, const int16_t *b, int n);
+int64_t dot_q15_simd(const int16_t *a, const int16_t *b, int n);
+
+/*
+ * 16탭 FIR: y[i] = sat16((sum_k h[k] * x[i + FIR_TAPS - 1 - k]) >> 15)
+ * x 는 n + FIR_TAPS - 1 개, y 는 n 개 (n은 짝수)
+ * SIMD 버전은 계수를 뒤집은 h_rev[k] = h[FIR_TAPS - 1 - k] 를 받습니다.
+ */
+void fir_q15_scalar(int16_t *y, const int16_t *x, const int16_t *h, int n);
+void fir_q15_simd(int16_t *y, const int16_t *x, const int16_t *h_rev, int n);
+
+/* 바이트 히스토그램 (hist[256] 은 호출 측이 0으로 초기화), n은 4의 배수 */
+void histogram_u8_scalar(uint32_t *hist, const uint8_t *data, int n);
+void histogram_u8_simd(uint32_t *hist, const uint8_t *data, int n);
+
+#endif /* DSP_KERNELS_H */
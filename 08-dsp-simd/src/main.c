@@ -0,0 +1,199 @@
+/*
+ * Cortex-M33 DSP/SIMD 실습 예제
+ * 패킹 산술(SIMD32) 커널과 스칼라 버전의 결과 비교 및 사이클 측정
+ */
+
+#include <stdint.h>
+#include "dsp_kernels.h"
+#include "report.h"
+#include "dwt.h"
+
+#define N_SAMPLES   256
+#define N_BYTES     1024
+#define REPEAT      4
+
+// ========== 테스트 데이터 ==========
+
+static int16_t a16[N_SAMPLES], b16[N_SAMPLES];
+static int16_t out_scalar[N_SAMPLES], out_simd[N_SAMPLES];
+static int16_t fir_input[N_SAMPLES + FIR_TAPS - 1];
+static uint8_t a8[N_BYTES], b8[N_BYTES];
+static uint8_t out8_scalar[N_BYTES], out8_simd[N_BYTES];
+static uint32_t hist_scalar[256], hist_simd[256];
+
+/* 저역 통과 형태의 Q15 계수 (합 ~ 1.0) */
+static const int16_t fir_coeffs[FIR_TAPS] = {
+     -120,  -310,   -90,   780,  2100,  3500,  4600,  5100,
+     5100,  4600,  3500,  2100,   780,   -90,  -310,  -120,
+};
+static int16_t fir_coeffs_rev[FIR_TAPS];
+
+static uint32_t lcg_state = 12345;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void fill_test_data(void) {
+    /* 포화 경로가 실제로 실행되도록 전체 범위 값 사용 */
+    for (int i = 0; i < N_SAMPLES; i++) {
+        a16[i] = (int16_t)(lcg_next() >> 16);
+        b16[i] = (int16_t)(lcg_next() >> 16);
+    }
+    for (int i = 0; i < N_SAMPLES + FIR_TAPS - 1; i++) {
+        fir_input[i] = (int16_t)(lcg_next() >> 17);
+    }
+    for (int i = 0; i < N_BYTES; i++) {
+        a8[i] = (uint8_t)(lcg_next() >> 24);
+        b8[i] = (uint8_t)(lcg_next() >> 24);
+    }
+    for (int k = 0; k < FIR_TAPS; k++) {
+        fir_coeffs_rev[k] = fir_coeffs[FIR_TAPS - 1 - k];
+    }
+}
+
+// ========== 결과 비교 및 출력 ==========
+
+static int failures;
+
+static int same16(const int16_t *x, const int16_t *y, int n) {
+    for (int i = 0; i < n; i++) {
+        if (x[i] != y[i]) return 0;
+    }
+    return 1;
+}
+
+static int same8(const uint8_t *x, const uint8_t *y, int n) {
+    for (int i = 0; i < n; i++) {
+        if (x[i] != y[i]) return 0;
+    }
+    return 1;
+}
+
+static int same32(const uint32_t *x, const uint32_t *y, int n) {
+    for (int i = 0; i < n; i++) {
+        if (x[i] != y[i]) return 0;
+    }
+    return 1;
+}
+
+static void print_row(const char *name, uint32_t scalar, uint32_t simd, int ok) {
+    print_string(name);
+    print_number(scalar, 10);
+    print_number(simd, 10);
+    
+    /* 속도 향상 (x100 정수 연산, 소수점 2자리) */
+    uint32_t ratio = simd ? (scalar * 100u) / simd : 0;
+    print_number(ratio / 100, 6);
+    print_string(".");
+    print_number((ratio % 100) / 10, 1);
+    print_number(ratio % 10, 1);
+    print_string("x");
+    print_string(ok ? "   OK\n" : "   MISMATCH\n");
+    
+    if (!ok) failures++;
+}
+
+/* 같은 커널을 REPEAT 번 실행해 최소 사이클을 잰다 */
+#define MEASURE(result, call)                       \
+    do {                                            \
+        uint32_t best_ = 0xFFFFFFFF;                \
+        for (int r_ = 0; r_ < REPEAT; r_++) {       \
+            uint32_t start_ = dwt_cycles();         \
+            call;                                   \
+            uint32_t c_ = dwt_elapsed(start_);      \
+            if (c_ < best_) best_ = c_;             \
+        }                                           \
+        (result) = best_;                           \
+    } while (0)
+
+// ========== 벤치마크 ==========
+
+static void bench_vector_add(void) {
+    uint32_t c_scalar, c_simd;
+    
+    asm volatile ("nop"); // Breakpoint 1: SADD16 벡터 덧셈
+    MEASURE(c_scalar, vec_add_q15_scalar(out_scalar, a16, b16, N_SAMPLES));
+    MEASURE(c_simd, vec_add_q15_simd(out_simd, a16, b16, N_SAMPLES));
+    print_row("vec_add_q15 (SADD16)    ", c_scalar, c_simd,
+              same16(out_scalar, out_simd, N_SAMPLES));
+    
+    MEASURE(c_scalar, vec_add_sat_q15_scalar(out_scalar, a16, b16, N_SAMPLES));
+    MEASURE(c_simd, vec_add_sat_q15_simd(out_simd, a16, b16, N_SAMPLES));
+    print_row("vec_add_sat_q15 (QADD16)", c_scalar, c_simd,
+              same16(out_scalar, out_simd, N_SAMPLES));
+    
+    MEASURE(c_scalar, vec_add_sat_u8_scalar(out8_scalar, a8, b8, N_BYTES));
+    MEASURE(c_simd, vec_add_sat_u8_simd(out8_simd, a8, b8, N_BYTES));
+    print_row("vec_add_sat_u8 (UQADD8) ", c_scalar, c_simd,
+              same8(out8_scalar, out8_simd, N_BYTES));
+}
+
+static void bench_dot_product(void) {
+    volatile int64_t r_scalar, r_simd;
+    uint32_t c_scalar, c_simd;
+    
+    asm volatile ("nop"); // Breakpoint 2: SMLALD 내적
+    MEASURE(c_scalar, r_scalar = dot_q15_scalar(a16, b16, N_SAMPLES));
+    MEASURE(c_simd, r_simd = dot_q15_simd(a16, b16, N_SAMPLES));
+    print_row("dot_q15 (SMLALD)        ", c_scalar, c_simd, r_scalar == r_simd);
+}
+
+static void bench_fir(void) {
+    uint32_t c_scalar, c_simd;
+    
+    asm volatile ("nop"); // Breakpoint 3: 16탭 FIR (SMLALD + SSAT)
+    MEASURE(c_scalar, fir_q15_scalar(out_scalar, fir_input, fir_coeffs, N_SAMPLES));
+    MEASURE(c_simd, fir_q15_simd(out_simd, fir_input, fir_coeffs_rev, N_SAMPLES));
+    print_row("fir16_q15 (SMLALD/SSAT) ", c_scalar, c_simd,
+              same16(out_scalar, out_simd, N_SAMPLES));
+}
+
+static void run_histogram(uint32_t *hist,
+                          void (*kernel)(uint32_t *, const uint8_t *, int)) {
+    for (int i = 0; i < 256; i++) {
+        hist[i] = 0;
+    }
+    kernel(hist, a8, N_BYTES);
+}
+
+static void bench_histogram(void) {
+    uint32_t c_scalar, c_simd;
+    
+    asm volatile ("nop"); // Breakpoint 4: 바이트 히스토그램
+    MEASURE(c_scalar, run_histogram(hist_scalar, histogram_u8_scalar));
+    MEASURE(c_simd, run_histogram(hist_simd, histogram_u8_simd));
+    print_row("histogram_u8 (LDR+UXTB) ", c_scalar, c_simd,
+              same32(hist_scalar, hist_simd, 256));
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 DSP/SIMD 커널 벤치마크 ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    print_string("측정 오버헤드 (보정됨): ");
+    print_number(dwt_overhead, 0);
+    print_string(" cycles\n\n");
+    
+    fill_test_data();
+    
+    print_string("kernel                      scalar      simd   speedup\n");
+    print_string("----------------------------------------------------------\n");
+    bench_vector_add();
+    bench_dot_product();
+    bench_fir();
+    bench_histogram();
+    
+    print_string("\n");
+    if (failures) {
+        print_number(failures, 0);
+        print_string(" kernel(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 SIMD 커널이 스칼라 결과와 일치합니다.\n");
+    exit_program(0);
+    return 0;
+}
@@ -0,0 +1,260 @@
+/*
+ * 고정소수점 라이브러리 호스트 레퍼런스
+ *
+ * vectors : 타겟이 비트 단위로 비교할 입력/기대값 헤더를 출력
+ *   - 결과가 정확히 정의된 연산(포화 덧셈/뺄셈, 버림 곱셈, 내림 제곱근)의 기대값은
+ *     fixmath.c/h 를 쓰지 않는 독립 모델(넓은 정수 + 명시적 내림/포화)로 계산
+ *   - 근사 연산(나눗셈, sin/cos)은 정답이 알고리즘에 따라 다르므로 src/fixmath.c 를
+ *     호스트에서 (DSP 명령어 없이 C 대체 코드로) 실행한 값이 기대값. 대신 벡터를 만들 때
+ *     double(libm) 대비 오차가 허용치(*_MAX_ERR)를 넘으면 실패해 빌드가 멈춤
+ * report  : double(libm) 대비 최대 오차(LSB)를 출력
+ *
+ * 사용 예 (Makefile 이 자동 실행):
+ *   cc -O2 -Isrc host/fixmath_ref.c src/fixmath.c -lm -o build/fixmath_ref
+ *   build/fixmath_ref vectors > build/fixmath_vectors.h
+ *   build/fixmath_ref report
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "fixmath.h"
+
+#define N 64
+
+/* 근사 연산의 double 대비 허용 오차 (LSB) */
+#define DIV_MAX_ERR     2.0
+#define Q15_TRIG_MAX_ERR 2.0
+#define CORDIC_MAX_ERR  64.0
+
+static q31_t a31[N], b31[N];
+static q15_t a15[N], b15[N];
+static uint32_t angle[N];
+
+static uint32_t lcg_state = 2024;
+
+static uint32_t lcg_next(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void make_inputs(void)
+{
+    /* 경계값 먼저, 나머지는 LCG */
+    static const q31_t edge31[] = { Q31_MAX, Q31_MIN, 0, 1, -1, 0x40000000, -0x40000000, 0x7FFF0000 };
+    static const q15_t edge15[] = { Q15_MAX, Q15_MIN, 0, 1, -1, 0x4000, -0x4000, 0x7F00 };
+    static const uint32_t edge_angle[] = { 0, 0x40000000, 0x80000000, 0xC0000000,
+                                           0x20000000, 0x60000000, 0xA0000000, 0xFFFFFFFF };
+
+    for (int i = 0; i < N; i++) {
+        a31[i] = (q31_t)lcg_next();
+        b31[i] = (q31_t)lcg_next();
+        a15[i] = (q15_t)(lcg_next() >> 16);
+        b15[i] = (q15_t)(lcg_next() >> 16);
+        angle[i] = lcg_next();
+    }
+    for (int i = 0; i < 8; i++) {
+        a31[i] = edge31[i];
+        b31[i] = edge31[7 - i];
+        a15[i] = edge15[i];
+        b15[i] = edge15[7 - i];
+        angle[i] = edge_angle[i];
+    }
+    /* 나눗셈은 |a| < |b| 인 경우가 의미 있으므로 절반은 그렇게 맞춤 */
+    for (int i = 8; i < N; i += 2) {
+        a31[i] /= 4;
+    }
+}
+
+// ========== 독립 모델 (fixmath.c/h 를 쓰지 않음) ==========
+
+static long long model_sat(long long x, long long lo, long long hi)
+{
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+/* x / 2^n 을 음수 쪽으로 내림 (산술 시프트에 기대지 않음) */
+static long long model_floor_div(long long x, int n)
+{
+    long long d = 1LL << n;
+    long long q = x / d;
+
+    if (x % d != 0 && x < 0) {
+        q--;
+    }
+    return q;
+}
+
+/* floor(sqrt(v)): double 근삿값을 정수 비교로 보정 */
+static long long model_isqrt(unsigned long long v)
+{
+    unsigned long long r = (unsigned long long)sqrt((double)v);
+
+    while (r > 0 && r * r > v) {
+        r--;
+    }
+    while ((r + 1) * (r + 1) <= v) {
+        r++;
+    }
+    return (long long)r;
+}
+
+#define SAT15(x) model_sat((x), -32768, 32767)
+#define SAT31(x) model_sat((x), -2147483648LL, 2147483647LL)
+
+static long long model_q15_add(long long a, long long b) { return SAT15(a + b); }
+static long long model_q15_mul(long long a, long long b) { return SAT15(model_floor_div(a * b, 15)); }
+static long long model_q15_sqrt(long long a) { return a > 0 ? model_isqrt((unsigned long long)a << 15) : 0; }
+static long long model_q31_add(long long a, long long b) { return SAT31(a + b); }
+static long long model_q31_sub(long long a, long long b) { return SAT31(a - b); }
+static long long model_q31_mul(long long a, long long b) { return SAT31(model_floor_div(a * b, 31)); }
+/* 상위 32비트(버림)를 두 배 하며 포화 */
+static long long model_q31_mul_fast(long long a, long long b) { return SAT31(2 * model_floor_div(a * b, 32)); }
+static long long model_q31_sqrt(long long a) { return a > 0 ? model_isqrt((unsigned long long)a << 31) : 0; }
+
+static double clamp(double x, double lo, double hi)
+{
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+/* 근사 연산 결과가 double 기준값에서 허용치 안에 있는지 (벗어나면 벡터 생성 실패) */
+static int within(const char *name, int i, double exact, long long actual, double limit)
+{
+    if (fabs(exact - (double)actual) <= limit) {
+        return 1;
+    }
+    fprintf(stderr, "fixmath_ref: %s[%d] = %lld, expected %.2f +/- %.1f\n", name, i, actual, exact, limit);
+    return 0;
+}
+
+static void print_array(const char *type, const char *name, const long long *v)
+{
+    printf("static const %s %s[FIXMATH_VECTOR_COUNT] = {", type, name);
+    for (int i = 0; i < N; i++) {
+        printf("%s%lld,", i % 8 ? " " : "\n    ", v[i]);
+    }
+    printf("\n};\n\n");
+}
+
+/* 근사 연산 허용 오차 검사. 하나라도 벗어나면 0 */
+static int check_approx(void)
+{
+    const double q31 = 2147483648.0;
+    int ok = 1;
+
+    for (int i = 0; i < N; i++) {
+        double rad15 = (angle[i] >> 16) * 2 * M_PI / 65536;
+        double rad31 = (double)angle[i] * 2 * M_PI / 4294967296.0;
+        q31_t s, c;
+
+        if (b31[i] != 0) {
+            ok &= within("q31_div", i, clamp((double)a31[i] / b31[i] * q31, -q31, q31 - 1),
+                         q31_div(a31[i], b31[i]), DIV_MAX_ERR);
+        }
+        ok &= within("q15_sin", i, 32767.0 * sin(rad15), q15_sin((uint16_t)(angle[i] >> 16)), Q15_TRIG_MAX_ERR);
+        ok &= within("q15_cos", i, 32767.0 * cos(rad15), q15_cos((uint16_t)(angle[i] >> 16)), Q15_TRIG_MAX_ERR);
+        q31_sin_cos(angle[i], &s, &c);
+        ok &= within("q31_sin", i, clamp(sin(rad31) * q31, -q31, q31 - 1), s, CORDIC_MAX_ERR);
+        ok &= within("q31_cos", i, clamp(cos(rad31) * q31, -q31, q31 - 1), c, CORDIC_MAX_ERR);
+    }
+    return ok;
+}
+
+static void emit_vectors(void)
+{
+    long long v[N];
+    q31_t s, c;
+
+    printf("/* 자동 생성 파일 - host/fixmath_ref.c (수정하지 마세요) */\n\n");
+    printf("#define FIXMATH_VECTOR_COUNT %d\n\n", N);
+
+#define EMIT(type, name, expr) \
+    do { for (int i = 0; i < N; i++) v[i] = (expr); print_array(type, name, v); } while (0)
+
+    EMIT("q31_t", "in_a31", a31[i]);
+    EMIT("q31_t", "in_b31", b31[i]);
+    EMIT("q15_t", "in_a15", a15[i]);
+    EMIT("q15_t", "in_b15", b15[i]);
+    EMIT("uint32_t", "in_angle", angle[i]);
+
+    /* 독립 모델 */
+    EMIT("q15_t", "exp_q15_add", model_q15_add(a15[i], b15[i]));
+    EMIT("q15_t", "exp_q15_mul", model_q15_mul(a15[i], b15[i]));
+    EMIT("q15_t", "exp_q15_sqrt", model_q15_sqrt(a15[i]));
+    EMIT("q31_t", "exp_q31_add", model_q31_add(a31[i], b31[i]));
+    EMIT("q31_t", "exp_q31_sub", model_q31_sub(a31[i], b31[i]));
+    EMIT("q31_t", "exp_q31_mul", model_q31_mul(a31[i], b31[i]));
+    EMIT("q31_t", "exp_q31_mul_fast", model_q31_mul_fast(a31[i], b31[i]));
+    EMIT("q31_t", "exp_q31_sqrt", model_q31_sqrt(a31[i]));
+
+    /* 근사 연산: 호스트 C 대체 코드 (check_approx 로 허용 오차 확인) */
+    EMIT("q15_t", "exp_q15_sin", q15_sin((uint16_t)(angle[i] >> 16)));
+    EMIT("q15_t", "exp_q15_cos", q15_cos((uint16_t)(angle[i] >> 16)));
+    EMIT("q31_t", "exp_q31_div", q31_div(a31[i], b31[i]));
+    EMIT("q31_t", "exp_q31_sin", (q31_sin_cos(angle[i], &s, &c), s));
+    EMIT("q31_t", "exp_q31_cos", (q31_sin_cos(angle[i], &s, &c), c));
+#undef EMIT
+}
+
+// ========== 정확도 보고서 ==========
+
+/* 포화를 반영한 기준값(raw 단위)과의 최대 오차 */
+static void report_line(const char *name, double max_err, const char *note)
+{
+    printf("%-14s %12.2f  %s\n", name, max_err, note);
+}
+
+static void emit_report(void)
+{
+    double e;
+    const double q15 = 32768.0, q31 = 2147483648.0;
+
+    printf("=== fixmath 정확도 (double 기준, 최대 오차 LSB) ===\n");
+    printf("%-14s %12s  %s\n", "operation", "max err", "note");
+
+#define MAXERR(count, exact, actual) \
+    do { e = 0; for (int i = 0; i < (count); i++) { double d = fabs((exact) - (actual)); if (d > e) e = d; } } while (0)
+
+    MAXERR(N, clamp(floor((double)a15[i] * b15[i] / q15), -q15, q15 - 1), q15_mul(a15[i], b15[i]));
+    report_line("q15_mul", e, "truncation");
+    MAXERR(N, clamp(floor((double)a31[i] * b31[i] / q31), -q31, q31 - 1), q31_mul(a31[i], b31[i]));
+    report_line("q31_mul", e, "SMULL, truncation");
+    MAXERR(N, clamp(floor((double)a31[i] * b31[i] / q31), -q31, q31 - 1), q31_mul_fast(a31[i], b31[i]));
+    report_line("q31_mul_fast", e, "SMMUL drops 1 LSB");
+    MAXERR(N, clamp((double)a31[i] / b31[i] * q31, -q31, q31 - 1), q31_div(a31[i], b31[i]));
+    report_line("q31_div", e, "reciprocal, 3 Newton steps");
+    MAXERR(N, a15[i] > 0 ? floor(sqrt((double)a15[i] * q15)) : 0, q15_sqrt(a15[i]));
+    report_line("q15_sqrt", e, "floor");
+    MAXERR(N, a31[i] > 0 ? floor(sqrt((double)a31[i] * q31)) : 0, q31_sqrt(a31[i]));
+    report_line("q31_sqrt", e, "floor");
+    MAXERR(65536, 32767.0 * sin(i * 2 * M_PI / 65536), q15_sin((uint16_t)i));
+    report_line("q15_sin", e, "129-entry table + lerp, all 65536 angles");
+
+    double es = 0, ec = 0;
+    for (int i = 0; i < 4096; i++) {
+        uint32_t a = (uint32_t)i << 20 | (lcg_next() & 0xFFFFF);
+        double rad = (double)a * 2 * M_PI / 4294967296.0;
+        q31_t s, c;
+        q31_sin_cos(a, &s, &c);
+        es = fmax(es, fabs(clamp(sin(rad) * q31, -q31, q31 - 1) - s));
+        ec = fmax(ec, fabs(clamp(cos(rad) * q31, -q31, q31 - 1) - c));
+    }
+    report_line("q31_sin", es, "CORDIC 28 iterations");
+    report_line("q31_cos", ec, "CORDIC 28 iterations");
+#undef MAXERR
+}
+
+int main(int argc, char **argv)
+{
+    make_inputs();
+    if (argc > 1 && strcmp(argv[1], "vectors") == 0) {
+        if (!check_approx()) {
+            return 1;
+        }
+        emit_vectors();
+    } else {
+        emit_report();
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * 고정소수점 수학 라이브러리 - 나눗셈, 제곱근, 삼각함수
+ *
+ * 이 파일은 타겟(arm-none-eabi-gcc)과 호스트(host/fixmath_ref.c) 양쪽에서
+ * 컴파일됩니다. 부동소수점과 나눗셈 명령어를 쓰지 않으므로 두 결과가 비트 단위로 같습니다.
+ */
+
+#include "fixmath.h"
+
+static inline int clz32(uint32_t x)
+{
+    return x ? __builtin_clz(x) : 32;               /* CLZ */
+}
+
+// ========== 역수 나눗셈 ==========
+
+/*
+ * 1. |b| 를 CLZ 로 정규화해 d ∈ [0.5, 1) 로 만든다 (Q32 부호 없는 값)
+ * 2. 초기 근사 r0 = 48/17 - 32/17 * d  (최대 오차 1/17)
+ * 3. 뉴턴 반복 r = r * (2 - d * r) 3회 - 정확한 비트 수 4 -> 8 -> 16 -> 32
+ * 4. a * r 을 정규화 시프트만큼 되돌림
+ */
+#define RECIP_C1    3031741621u     /* 48/17 in Q30 */
+#define RECIP_C2    2021161080u     /* 32/17 in Q30 */
+
+q31_t q31_div(q31_t a, q31_t b)
+{
+    int negative = (a < 0) != (b < 0);
+    uint32_t ua = a < 0 ? 0u - (uint32_t)a : (uint32_t)a;
+    uint32_t ub = b < 0 ? 0u - (uint32_t)b : (uint32_t)b;
+
+    if (ub == 0 || ua >= ub) {
+        if (ua == 0) {
+            return 0;
+        }
+        /* |결과| >= 1.0 : 포화 (정확히 -1.0 은 표현 가능) */
+        return negative ? Q31_MIN : Q31_MAX;
+    }
+
+    int s = clz32(ub);
+    uint32_t d = ub << s;                           /* Q32, [0.5, 1) */
+    uint32_t r = RECIP_C1 - (uint32_t)(((uint64_t)RECIP_C2 * d) >> 32);   /* Q30, (1, 2] */
+
+    for (int i = 0; i < 3; i++) {
+        uint32_t t = (uint32_t)(((uint64_t)d * r) >> 32);                 /* d*r, Q30 ~ 1.0 */
+        r = (uint32_t)(((uint64_t)r * ((1u << 31) - t)) >> 30);          /* UMULL */
+    }
+
+    /* a/b = a * r * 2^(s-1) -> Q31 결과 = (ua * r) >> (31 - s) */
+    uint64_t q = ((uint64_t)ua * r) >> (31 - s);
+    if (q > (uint64_t)Q31_MAX) {
+        q = Q31_MAX;
+    }
+    return negative ? -(q31_t)q : (q31_t)q;
+}
+
+// ========== 제곱근 ==========
+
+/* floor(sqrt(v)) - 비트 단위(digit-by-digit) 방식, 나눗셈 없음 */
+static uint32_t isqrt64(uint64_t v)
+{
+    uint64_t result = 0;
+    uint64_t bit = 1ull << 62;
+
+    /* 시작 비트를 v 이하의 가장 큰 4의 거듭제곱으로 (CLZ) */
+    uint32_t hi = (uint32_t)(v >> 32);
+    int lz = hi ? clz32(hi) : 32 + clz32((uint32_t)v);
+    if (lz >= 64) {
+        return 0;
+    }
+    bit >>= lz & ~1;
+
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+q31_t q31_sqrt(q31_t x)
+{
+    if (x <= 0) {
+        return 0;
+    }
+    /* sqrt(x / 2^31) * 2^31 = sqrt(x * 2^31) */
+    return (q31_t)isqrt64((uint64_t)x << 31);
+}
+
+q15_t q15_sqrt(q15_t x)
+{
+    if (x <= 0) {
+        return 0;
+    }
+    return (q15_t)isqrt64((uint64_t)x << 15);
+}
+
+// ========== sin/cos (테이블 + 선형 보간) ==========
+
+/* sin(i * 90도 / 128) * 32767, i = 0..128 (1/4 주기) */
+static const q15_t quarter_sine[129] = {
+        0,   402,   804,  1206,  1608,  2009,  2410,  2811,
+     3212,  3612,  4011,  4410,  4808,  5205,  5602,  5998,
+     6393,  6786,  7179,  7571,  7962,  8351,  8739,  9126,
+     9512,  9896, 10278, 10659, 11039, 11417, 11793, 12167,
+    12539, 12910, 13279, 13645, 14010, 14372, 14732, 15090,
+    15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+    18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475,
+    20787, 21096, 21403, 21705, 22005, 22301, 22594, 22884,
+    23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072,
+    25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019,
+    27245, 27466, 27683, 27896, 28105, 28310, 28510, 28706,
+    28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+    30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237,
+    31356, 31470, 31580, 31685, 31785, 31880, 31971, 32057,
+    32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+    32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765,
+    32767,
+};
+
+q15_t q15_sin(uint16_t angle)
+{
+    /* 상위 2비트: 사분면, 다음 7비트: 테이블 인덱스, 하위 7비트: 보간 비율 */
+    unsigned quadrant = angle >> 14;
+    unsigned pos = angle & 0x3FFF;
+
+    if (quadrant & 1) {
+        pos = 0x4000 - pos;                         /* 2, 4 사분면은 대칭 */
+    }
+    unsigned index = pos >> 7;
+    int32_t frac = pos & 0x7F;
+    int32_t value = quarter_sine[index];
+    if (index < 128) {
+        value += ((quarter_sine[index + 1] - value) * frac) >> 7;
+    }
+    return (q15_t)(quadrant & 2 ? -value : value);
+}
+
+q15_t q15_cos(uint16_t angle)
+{
+    return q15_sin((uint16_t)(angle + 0x4000));
+}
+
+// ========== sin/cos (CORDIC) ==========
+
+#define CORDIC_ITERATIONS   28
+#define CORDIC_GAIN_Q30     652032874       /* 0.607252935 = prod(1/sqrt(1 + 2^-2i)) */
+
+/* atan(2^-i) 를 이진 각도(한 바퀴 = 2^32)로 표현한 값 */
+static const int32_t cordic_atan[CORDIC_ITERATIONS] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+    2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+    10430, 5215, 2608, 1304, 652, 326, 163, 81,
+    41, 20, 10, 5,
+};
+
+void q31_sin_cos(uint32_t angle, q31_t *sin_out, q31_t *cos_out)
+{
+    /* CORDIC 수렴 범위(약 ±99.7도) 밖인 2, 3 사분면은 180도 돌려서 계산 후 부호 반전 */
+    int32_t z = (int32_t)angle;
+    int flip = 0;
+    if (z > 0x40000000 || z < -0x40000000) {
+        z = (int32_t)(angle + 0x80000000u);
+        flip = 1;
+    }
+
+    /* 내부는 Q30: 회전 중 |x|, |y| 가 1.0 을 살짝 넘어도 여유가 있음 */
+    int32_t x = CORDIC_GAIN_Q30;
+    int32_t y = 0;
+    for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+        int32_t dx = y >> i;                        /* ASR - 시프트와 덧셈만 사용 */
+        int32_t dy = x >> i;
+        if (z >= 0) {
+            x -= dx;
+            y += dy;
+            z -= cordic_atan[i];
+        } else {
+            x += dx;
+            y -= dy;
+            z += cordic_atan[i];
+        }
+    }
+
+    if (flip) {
+        x = -x;
+        y = -y;
+    }
+    *sin_out = q31_sat((int64_t)y * 2);
+    *cos_out = q31_sat((int64_t)x * 2);
+}
@@ -0,0 +1,128 @@
+/*
+ * 고정소수점 수학 라이브러리 (Q15 / Q31)
+ *
+ *   q15_t : 16비트, 값 = raw / 2^15, 범위 [-1.0, 1.0)
+ *   q31_t : 32비트, 값 = raw / 2^31, 범위 [-1.0, 1.0)
+ *
+ * 모든 연산은 포화(saturation)합니다. 예) -1.0 * -1.0 = +0.99997 (최댓값)
+ *
+ * Cortex-M33 (DSP 확장)에서는 SMULL/SMMUL/QADD/SSAT 로 번역되고,
+ * 그 외 환경(호스트 PC)에서는 같은 결과를 내는 C 코드로 대체됩니다.
+ * host/fixmath_ref.c 가 호스트에서 만든 기대값과 타겟 결과를 비트 단위로 비교합니다.
+ */
+
+#ifndef FIXMATH_H
+#define FIXMATH_H
+
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include <arm_acle.h>
+#define FIXMATH_USE_DSP 1
+#else
+#define FIXMATH_USE_DSP 0
+#endif
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+#define Q15_MAX     ((q15_t)0x7FFF)
+#define Q15_MIN     ((q15_t)0x8000)
+#define Q31_MAX     ((q31_t)0x7FFFFFFF)
+#define Q31_MIN     ((q31_t)0x80000000)
+
+/* 실수 상수 -> Q 형식 (컴파일 타임 상수 전용) */
+#define Q15(x)      ((q15_t)((x) >= 0.99996948 ? 0x7FFF : (x) * 32768.0))
+#define Q31(x)      ((q31_t)((x) >= 0.99999999953 ? 0x7FFFFFFF : (x) * 2147483648.0))
+
+// ========== 포화 ==========
+
+static inline q15_t q15_sat(int32_t x)
+{
+#if FIXMATH_USE_DSP
+    return (q15_t)__ssat(x, 16);                    /* SSAT #16 */
+#else
+    return x > 32767 ? 32767 : x < -32768 ? -32768 : (q15_t)x;
+#endif
+}
+
+static inline q31_t q31_sat(int64_t x)
+{
+    return x > Q31_MAX ? Q31_MAX : x < Q31_MIN ? Q31_MIN : (q31_t)x;
+}
+
+// ========== 덧셈 / 뺄셈 ==========
+
+static inline q15_t q15_add(q15_t a, q15_t b)
+{
+    return q15_sat((int32_t)a + b);
+}
+
+static inline q31_t q31_add(q31_t a, q31_t b)
+{
+#if FIXMATH_USE_DSP
+    return __qadd(a, b);                            /* QADD */
+#else
+    return q31_sat((int64_t)a + b);
+#endif
+}
+
+static inline q31_t q31_sub(q31_t a, q31_t b)
+{
+#if FIXMATH_USE_DSP
+    return __qsub(a, b);                            /* QSUB */
+#else
+    return q31_sat((int64_t)a - b);
+#endif
+}
+
+// ========== 곱셈 ==========
+
+/* Q15 x Q15: SMULBB 후 >> 15, SSAT (버림) */
+static inline q15_t q15_mul(q15_t a, q15_t b)
+{
+    return q15_sat(((int32_t)a * b) >> 15);
+}
+
+/* Q31 x Q31: SMULL 64비트 곱의 >> 31 (버림, -1 x -1 만 포화) */
+static inline q31_t q31_mul(q31_t a, q31_t b)
+{
+    return q31_sat(((int64_t)a * b) >> 31);
+}
+
+/*
+ * Q31 x Q31 빠른 버전: SMMUL 은 곱의 상위 32비트만 계산 (= >> 32, Q30)
+ * QADD 로 두 배 하면서 포화 -> q31_mul 보다 최하위 비트 1개가 덜 정확
+ */
+static inline q31_t q31_mul_fast(q31_t a, q31_t b)
+{
+#if FIXMATH_USE_DSP
+    int32_t hi;
+    __asm__ ("smmul %0, %1, %2" : "=r" (hi) : "r" (a), "r" (b));
+    return __qadd(hi, hi);
+#else
+    int32_t hi = (int32_t)(((int64_t)a * b) >> 32);
+    return q31_sat((int64_t)hi * 2);
+#endif
+}
+
+// ========== 나눗셈 / 제곱근 / 삼각함수 (fixmath.c) ==========
+
+/* a / b 를 역수(뉴턴-랩슨) 곱셈으로 계산, |a| >= |b| 이면 포화 */
+q31_t q31_div(q31_t a, q31_t b);
+
+/* sqrt(x), x < 0 이면 0 */
+q31_t q31_sqrt(q31_t x);
+q15_t q15_sqrt(q15_t x);
+
+/*
+ * 각도: 이진 각도 (binary angle) - 한 바퀴 = 2^16 (q15) 또는 2^32 (q31)
+ *   0x4000 = 90도, 0x8000 = 180도
+ */
+q15_t q15_sin(uint16_t angle);
+q15_t q15_cos(uint16_t angle);
+
+/* CORDIC 회전 모드 - sin/cos 동시 계산 (Q31) */
+void q31_sin_cos(uint32_t angle, q31_t *sin_out, q31_t *cos_out);
+
+#endif /* FIXMATH_H */
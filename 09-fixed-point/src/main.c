@@ -0,0 +1,145 @@
+/*
+ * Cortex-M33 고정소수점(Q15/Q31) 실습 예제
+ * 호스트가 만든 기대값과 비트 단위 비교 + 연산별 사이클 비용 표
+ * (정확히 정의된 연산은 독립 모델, 근사 연산은 호스트에서 실행한 C 대체 코드가 기대값)
+ */
+
+#include <stdint.h>
+#include "fixmath.h"
+#include "fixmath_vectors.h"    /* 빌드 시 host/fixmath_ref.c 가 생성 */
+#include "report.h"
+#include "dwt.h"
+
+#define REPEAT 4
+
+// ========== 측정 ==========
+
+static q31_t res31[FIXMATH_VECTOR_COUNT];
+static q15_t res15[FIXMATH_VECTOR_COUNT];
+static uint32_t loop_overhead;     /* 결과 저장 루프 자체의 비용 */
+static int failures;
+
+static inline q31_t cordic_sin(uint32_t angle) {
+    q31_t s, c;
+    q31_sin_cos(angle, &s, &c);
+    return s;
+}
+
+/* 벡터 전체에 연산을 적용하고 REPEAT 회 중 최소 사이클을 반환 */
+#define RUN(result, expr)                                           \
+    do {                                                            \
+        uint32_t best_ = 0xFFFFFFFF;                                \
+        for (int r_ = 0; r_ < REPEAT; r_++) {                       \
+            uint32_t start_ = dwt_cycles();                         \
+            for (int i = 0; i < FIXMATH_VECTOR_COUNT; i++) {        \
+                result[i] = (expr);                                 \
+            }                                                       \
+            uint32_t c_ = dwt_elapsed(start_);                      \
+            if (c_ < best_) best_ = c_;                             \
+        }                                                           \
+        cycles = best_;                                             \
+    } while (0)
+
+static int same31(const q31_t *x, const q31_t *y) {
+    for (int i = 0; i < FIXMATH_VECTOR_COUNT; i++) {
+        if (x[i] != y[i]) return 0;
+    }
+    return 1;
+}
+
+static int same15(const q15_t *x, const q15_t *y) {
+    for (int i = 0; i < FIXMATH_VECTOR_COUNT; i++) {
+        if (x[i] != y[i]) return 0;
+    }
+    return 1;
+}
+
+/* ref: 기대값 출처 - "model" (독립 모델) / "host C" (호스트 C 대체 코드, 오차 허용치 확인됨) */
+static void print_row(const char *name, const char *insn, uint32_t cycles, int ok, const char *ref) {
+    /* 연산 1회당 사이클 (x100, 루프 오버헤드 제외) */
+    uint32_t net = cycles > loop_overhead ? cycles - loop_overhead : 0;
+    uint32_t per_op = net * 100u / FIXMATH_VECTOR_COUNT;
+    
+    print_string(name);
+    print_string(insn);
+    print_number(per_op / 100, 6);
+    print_string(".");
+    print_number((per_op % 100) / 10, 1);
+    print_number(per_op % 10, 1);
+    print_string(ok ? "   OK        " : "   MISMATCH  ");
+    print_string(ref);
+    print_string("\n");
+    
+    if (!ok) failures++;
+}
+
+static void bench_q15(void) {
+    uint32_t cycles;
+    
+    asm volatile ("nop"); // Breakpoint 1: Q15 연산 (SSAT)
+    RUN(res15, q15_add(in_a15[i], in_b15[i]));
+    print_row("q15_add       ", "SSAT               ", cycles, same15(res15, exp_q15_add), "model");
+    RUN(res15, q15_mul(in_a15[i], in_b15[i]));
+    print_row("q15_mul       ", "SMULBB + SSAT      ", cycles, same15(res15, exp_q15_mul), "model");
+    RUN(res15, q15_sqrt(in_a15[i]));
+    print_row("q15_sqrt      ", "CLZ + bit-by-bit   ", cycles, same15(res15, exp_q15_sqrt), "model");
+    RUN(res15, q15_sin((uint16_t)(in_angle[i] >> 16)));
+    print_row("q15_sin       ", "table + lerp       ", cycles, same15(res15, exp_q15_sin), "host C");
+    RUN(res15, q15_cos((uint16_t)(in_angle[i] >> 16)));
+    print_row("q15_cos       ", "table + lerp       ", cycles, same15(res15, exp_q15_cos), "host C");
+}
+
+static void bench_q31(void) {
+    uint32_t cycles;
+    
+    asm volatile ("nop"); // Breakpoint 2: Q31 연산 (QADD/SMULL/SMMUL)
+    RUN(res31, q31_add(in_a31[i], in_b31[i]));
+    print_row("q31_add       ", "QADD               ", cycles, same31(res31, exp_q31_add), "model");
+    RUN(res31, q31_sub(in_a31[i], in_b31[i]));
+    print_row("q31_sub       ", "QSUB               ", cycles, same31(res31, exp_q31_sub), "model");
+    RUN(res31, q31_mul(in_a31[i], in_b31[i]));
+    print_row("q31_mul       ", "SMULL + sat        ", cycles, same31(res31, exp_q31_mul), "model");
+    RUN(res31, q31_mul_fast(in_a31[i], in_b31[i]));
+    print_row("q31_mul_fast  ", "SMMUL + QADD       ", cycles, same31(res31, exp_q31_mul_fast), "model");
+    
+    asm volatile ("nop"); // Breakpoint 3: 나눗셈/제곱근/CORDIC
+    RUN(res31, q31_div(in_a31[i], in_b31[i]));
+    print_row("q31_div       ", "CLZ + Newton x3    ", cycles, same31(res31, exp_q31_div), "host C");
+    RUN(res31, q31_sqrt(in_a31[i]));
+    print_row("q31_sqrt      ", "CLZ + bit-by-bit   ", cycles, same31(res31, exp_q31_sqrt), "model");
+    RUN(res31, cordic_sin(in_angle[i]));
+    print_row("q31_sin_cos   ", "CORDIC x28         ", cycles, same31(res31, exp_q31_sin), "host C");
+}
+
+int main(void) {
+    uint32_t cycles;
+    
+    print_string("=== Cortex-M33 고정소수점 (Q15/Q31) 라이브러리 ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    
+    /* 기준: 입력을 그대로 복사하는 루프 */
+    RUN(res31, in_a31[i]);
+    loop_overhead = cycles;
+    
+    print_string("테스트 벡터: ");
+    print_number(FIXMATH_VECTOR_COUNT, 0);
+    print_string("개 (호스트가 만든 기대값과 비트 단위 비교)\n\n");
+    
+    print_string("operation     instructions           cyc/op   bit-exact expected\n");
+    print_string("------------------------------------------------------------------\n");
+    bench_q15();
+    bench_q31();
+    
+    print_string("\n");
+    if (failures) {
+        print_number(failures, 0);
+        print_string(" operation(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 연산이 기대값과 비트 단위로 일치합니다.\n");
+    exit_program(0);
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * 비트맵 할당기 구현
+ *
+ * 2단계 구조: summary 워드의 비트 하나가 free_mask 워드 하나를 대표하므로
+ * 빈 슬롯 찾기 = ctz(summary) -> ctz(free_mask[w]) 두 번으로 끝납니다.
+ */
+
+#include "bitmap.h"
+#include "bitops.h"
+
+void bitmap_init(bitmap_t *bm)
+{
+    for (int w = 0; w < BITMAP_WORDS; w++) {
+        bm->free_mask[w] = 0xFFFFFFFFu;
+    }
+    bm->summary = (BITMAP_WORDS == 32) ? 0xFFFFFFFFu : (1u << BITMAP_WORDS) - 1;
+}
+
+int bitmap_alloc(bitmap_t *bm)
+{
+    if (bm->summary == 0) {
+        return -1;
+    }
+    uint32_t w = bit_ctz(bm->summary);
+    uint32_t bit = bit_ctz(bm->free_mask[w]);
+
+    bm->free_mask[w] &= bm->free_mask[w] - 1;       /* 가장 낮은 1 비트 지우기 */
+    if (bm->free_mask[w] == 0) {
+        bm->summary &= ~(1u << w);
+    }
+    return (int)(w * 32 + bit);
+}
+
+int bitmap_alloc_naive(bitmap_t *bm)
+{
+    for (int slot = 0; slot < BITMAP_SLOTS; slot++) {
+        uint32_t w = slot / 32;
+        uint32_t mask = 1u << (slot % 32);
+        if (bm->free_mask[w] & mask) {
+            bm->free_mask[w] &= ~mask;
+            if (bm->free_mask[w] == 0) {
+                bm->summary &= ~(1u << w);
+            }
+            return slot;
+        }
+    }
+    return -1;
+}
+
+void bitmap_free(bitmap_t *bm, int slot)
+{
+    uint32_t w = (uint32_t)slot / 32;
+
+    bm->free_mask[w] |= 1u << (slot % 32);
+    bm->summary |= 1u << w;
+}
+
+uint32_t bitmap_available(const bitmap_t *bm)
+{
+    uint32_t count = 0;
+    for (int w = 0; w < BITMAP_WORDS; w++) {
+        count += bit_popcount(bm->free_mask[w]);
+    }
+    return count;
+}
@@ -0,0 +1,32 @@
+/*
+ * 비트맵 할당기 - 고정 크기 슬롯 BITMAP_SLOTS 개
+ *
+ * 비트 1 = 사용 가능. 빈 슬롯 찾기는 워드마다 RBIT + CLZ 한 번
+ * (naive 버전은 비트를 하나씩 검사)
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdint.h>
+
+#define BITMAP_SLOTS    256
+#define BITMAP_WORDS    (BITMAP_SLOTS / 32)
+
+typedef struct {
+    uint32_t free_mask[BITMAP_WORDS];   /* 비트 1 = 비어 있음 */
+    uint32_t summary;                   /* 비트 w = free_mask[w] 에 빈 슬롯 있음 */
+} bitmap_t;
+
+void bitmap_init(bitmap_t *bm);
+
+/* 가장 낮은 번호의 빈 슬롯을 할당, 없으면 -1 */
+int bitmap_alloc(bitmap_t *bm);
+int bitmap_alloc_naive(bitmap_t *bm);
+
+void bitmap_free(bitmap_t *bm, int slot);
+
+/* 남은 슬롯 수 (popcount) */
+uint32_t bitmap_available(const bitmap_t *bm);
+
+#endif /* BITMAP_H */
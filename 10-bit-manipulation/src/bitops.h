@@ -0,0 +1,121 @@
+/*
+ * 비트 조작 기본 연산 - Cortex-M33 의 단일 사이클 명령어 사용
+ *
+ *   CLZ   : 상위부터 0 의 개수 (0 이면 32)
+ *   RBIT  : 비트 순서 뒤집기 -> RBIT + CLZ = 하위부터 0 의 개수 (ctz)
+ *   REV   : 바이트 순서 뒤집기 (엔디언 변환)
+ *   REV16 : 하프워드 안의 바이트 교환
+ *   UBFX  : 비트필드 추출 (lsb, width 는 즉시값)
+ *   BFI   : 비트필드 삽입 (lsb, width 는 즉시값)
+ */
+
+#ifndef BITOPS_H
+#define BITOPS_H
+
+#include <stdint.h>
+
+static inline uint32_t bit_clz(uint32_t x)
+{
+    uint32_t n;
+    __asm__ ("clz %0, %1" : "=r" (n) : "r" (x));
+    return n;                                       /* x == 0 이면 32 */
+}
+
+static inline uint32_t bit_rbit(uint32_t x)
+{
+    uint32_t r;
+    __asm__ ("rbit %0, %1" : "=r" (r) : "r" (x));
+    return r;
+}
+
+/* 가장 낮은 1 비트의 위치 (0..31), x == 0 이면 32 */
+static inline uint32_t bit_ctz(uint32_t x)
+{
+    return bit_clz(bit_rbit(x));
+}
+
+/* POSIX ffs: 가장 낮은 1 비트 위치 + 1, x == 0 이면 0 */
+static inline uint32_t bit_ffs(uint32_t x)
+{
+    return x ? bit_ctz(x) + 1 : 0;
+}
+
+/* 가장 높은 1 비트 위치 + 1 (fls), x == 0 이면 0 */
+static inline uint32_t bit_fls(uint32_t x)
+{
+    return 32 - bit_clz(x);
+}
+
+/* floor(log2(x)), x == 0 이면 -1 */
+static inline int32_t bit_log2(uint32_t x)
+{
+    return 31 - (int32_t)bit_clz(x);
+}
+
+/* ceil(log2(x)), x <= 1 이면 0 */
+static inline int32_t bit_log2_ceil(uint32_t x)
+{
+    return x <= 1 ? 0 : 32 - (int32_t)bit_clz(x - 1);
+}
+
+/* x 이상인 가장 작은 2의 거듭제곱 (x > 2^31 이면 0) */
+static inline uint32_t bit_round_up_pow2(uint32_t x)
+{
+    return x <= 1 ? 1 : (bit_clz(x - 1) == 0 ? 0 : 1u << (32 - bit_clz(x - 1)));
+}
+
+/*
+ * popcount - M33 에는 전용 명령어가 없습니다.
+ * 희소한 워드: CLZ 로 최상위 1 비트를 하나씩 지움 (1 비트 개수만큼 반복)
+ * 밀집한 워드: SWAR (병렬 비트 합산, 분기 없이 12 명령어 안팎)
+ */
+static inline uint32_t bit_popcount_sparse(uint32_t x)
+{
+    uint32_t count = 0;
+    while (x) {
+        x &= ~(0x80000000u >> bit_clz(x));
+        count++;
+    }
+    return count;
+}
+
+static inline uint32_t bit_popcount(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+    return (x * 0x01010101u) >> 24;                 /* MUL 로 바이트 합 */
+}
+
+static inline uint32_t bit_bswap32(uint32_t x)
+{
+    uint32_t r;
+    __asm__ ("rev %0, %1" : "=r" (r) : "r" (x));
+    return r;
+}
+
+static inline uint32_t bit_bswap16x2(uint32_t x)
+{
+    uint32_t r;
+    __asm__ ("rev16 %0, %1" : "=r" (r) : "r" (x));
+    return r;
+}
+
+/* lsb, width 는 컴파일 타임 상수여야 합니다 (즉시값 인코딩) */
+#define BIT_UBFX(x, lsb, width)                                         \
+    ({                                                                  \
+        uint32_t r_;                                                    \
+        __asm__ ("ubfx %0, %1, %2, %3"                                  \
+                 : "=r" (r_) : "r" ((uint32_t)(x)), "n" (lsb), "n" (width)); \
+        r_;                                                             \
+    })
+
+#define BIT_BFI(dst, value, lsb, width)                                 \
+    ({                                                                  \
+        uint32_t r_ = (dst);                                            \
+        __asm__ ("bfi %0, %1, %2, %3"                                   \
+                 : "+r" (r_) : "r" ((uint32_t)(value)), "n" (lsb), "n" (width)); \
+        r_;                                                             \
+    })
+
+#endif /* BITOPS_H */
@@ -0,0 +1,241 @@
+/*
+ * Cortex-M33 비트 조작 실습 예제
+ * CLZ/RBIT/REV/UBFX/BFI 기반 연산과 단순 반복문 버전의 결과/사이클 비교
+ */
+
+#include <stdint.h>
+#include "bitops.h"
+#include "bitmap.h"
+#include "report.h"
+#include "dwt.h"
+#include "gen_tables.h"   // build/gen_tables.h (tools/gentables 가 빌드 시 생성)
+
+#define N 256
+
+void print_hex(unsigned int value) {
+    char hex_str[12] = "0x00000000\n";
+    
+    // 바이트마다 gen_hex_pairs 에서 두 글자 (매 호출 스택에 표를 만들지 않음)
+    for (int i = 3; i >= 0; i--) {
+        unsigned int pair = (value & 0xFF) * 2;
+        hex_str[2 + i * 2] = gen_hex_pairs[pair];
+        hex_str[3 + i * 2] = gen_hex_pairs[pair + 1];
+        value >>= 8;
+    }
+    
+    print_string(hex_str);
+}
+
+// ========== 단순 반복문 버전 (비교 기준) ==========
+// noinline: 컴파일러가 호출 측 상수로 접어 버리지 않도록
+
+__attribute__((noinline)) uint32_t naive_ctz(uint32_t x) {
+    uint32_t n = 0;
+    if (x == 0) return 32;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+
+__attribute__((noinline)) uint32_t naive_popcount(uint32_t x) {
+    uint32_t count = 0;
+    for (int i = 0; i < 32; i++) {
+        count += (x >> i) & 1;
+    }
+    return count;
+}
+
+__attribute__((noinline)) int32_t naive_log2(uint32_t x) {
+    int32_t n = -1;
+    while (x) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+
+__attribute__((noinline)) uint32_t naive_bswap32(uint32_t x) {
+    uint32_t r = 0;
+    for (int i = 0; i < 4; i++) {
+        r = (r << 8) | (x & 0xFF);
+        x >>= 8;
+    }
+    return r;
+}
+
+/* 패킹된 헤더 워드 [31:28 ver][27:20 type][19:8 length][7:0 seq] 해석 */
+__attribute__((noinline)) uint32_t naive_field(uint32_t x, uint32_t lsb, uint32_t width) {
+    return (x >> lsb) & ((1u << width) - 1);
+}
+
+// ========== 테스트 데이터 ==========
+
+static uint32_t data[N];
+static volatile uint32_t sink;
+static uint32_t lcg_state = 0xC0FFEE;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void fill_data(void) {
+    static const uint32_t edges[] = { 0, 1, 0x80000000u, 0xFFFFFFFFu, 0x00010000u, 0x7FFFFFFFu };
+    
+    for (int i = 0; i < N; i++) {
+        /* 하위 비트가 0 인 값을 섞어 ctz/log2 반복 횟수가 다양하도록 */
+        data[i] = lcg_next() >> (lcg_next() >> 27);
+    }
+    for (unsigned i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+        data[i] = edges[i];
+    }
+}
+
+// ========== 결과 검증 ==========
+
+static void verify(void) {
+    int ok_ctz = 1, ok_pop = 1, ok_log = 1, ok_rev = 1, ok_field = 1;
+    
+    for (int i = 0; i < N; i++) {
+        uint32_t x = data[i];
+        ok_ctz &= bit_ctz(x) == naive_ctz(x);
+        ok_pop &= bit_popcount(x) == naive_popcount(x);
+        ok_pop &= bit_popcount_sparse(x) == naive_popcount(x);
+        ok_log &= bit_log2(x) == naive_log2(x);
+        ok_rev &= bit_bswap32(x) == naive_bswap32(x);
+        ok_field &= BIT_UBFX(x, 8, 12) == naive_field(x, 8, 12);
+        ok_field &= BIT_UBFX(x, 28, 4) == naive_field(x, 28, 4);
+    }
+    check("ctz (RBIT+CLZ) / ffs", ok_ctz && bit_ffs(0) == 0 && bit_ffs(0x100) == 9);
+    check("popcount (SWAR, CLZ sparse)", ok_pop);
+    check("log2 (CLZ), log2_ceil, round_up_pow2",
+          ok_log && bit_log2_ceil(17) == 5 && bit_log2_ceil(16) == 4 &&
+          bit_round_up_pow2(17) == 32 && bit_round_up_pow2(0x80000001u) == 0);
+    check("bswap32 (REV) / bswap16x2 (REV16)",
+          ok_rev && bit_bswap16x2(0x11223344u) == 0x22114433u);
+    check("UBFX / BFI",
+          ok_field && BIT_BFI(0xFFFFFFFFu, 0x5A, 8, 8) == 0xFFFF5AFFu &&
+          BIT_BFI(0, 0x1FF, 4, 4) == 0xF0u);
+}
+
+// ========== 비트맵 할당기 ==========
+
+static bitmap_t pool;
+
+/* bitmap_round 한 번의 alloc 호출 수: 전부 + 가득 찬 뒤 1번 + 짝수 슬롯 다시 */
+#define BITMAP_ROUND_ALLOCS (BITMAP_SLOTS + 1 + BITMAP_SLOTS / 2)
+
+static int bitmap_round(int (*alloc)(bitmap_t *)) {
+    /* 전부 할당 -> 짝수 슬롯 해제 -> 다시 할당 (구멍 찾기) */
+    int ok = 1;
+    bitmap_init(&pool);
+    for (int i = 0; i < BITMAP_SLOTS; i++) {
+        ok &= alloc(&pool) == i;
+    }
+    ok &= alloc(&pool) == -1;
+    for (int i = 0; i < BITMAP_SLOTS; i += 2) {
+        bitmap_free(&pool, i);
+    }
+    ok &= bitmap_available(&pool) == BITMAP_SLOTS / 2;
+    for (int i = 0; i < BITMAP_SLOTS; i += 2) {
+        ok &= alloc(&pool) == i;
+    }
+    return ok;
+}
+
+// ========== 벤치마크 ==========
+
+static void print_row(const char *name, uint32_t naive, uint32_t fast) {
+    uint32_t ratio = fast ? naive * 100u / fast : 0;
+    
+    print_string(name);
+    print_number(naive, 10);
+    print_number(fast, 10);
+    print_number(ratio / 100, 6);
+    print_string(".");
+    print_number((ratio % 100) / 10, 1);
+    print_number(ratio % 10, 1);
+    print_string("x\n");
+}
+
+#define MEASURE(result, expr)                       \
+    do {                                            \
+        uint32_t start_ = dwt_cycles();             \
+        for (int i = 0; i < N; i++) {               \
+            sink = (expr);                          \
+        }                                           \
+        (result) = dwt_elapsed(start_);             \
+    } while (0)
+
+static void benchmark(void) {
+    uint32_t c_naive, c_fast;
+    
+    print_string("\noperation (N=256)         naive      fast   speedup\n");
+    print_string("---------------------------------------------------\n");
+    
+    asm volatile ("nop"); // Breakpoint 1: ctz / popcount / log2
+    MEASURE(c_naive, naive_ctz(data[i]));
+    MEASURE(c_fast, bit_ctz(data[i]));
+    print_row("ctz      (RBIT+CLZ)  ", c_naive, c_fast);
+    
+    MEASURE(c_naive, naive_popcount(data[i]));
+    MEASURE(c_fast, bit_popcount(data[i]));
+    print_row("popcount (SWAR)      ", c_naive, c_fast);
+    
+    MEASURE(c_naive, naive_log2(data[i]));
+    MEASURE(c_fast, (uint32_t)bit_log2(data[i]));
+    print_row("log2     (CLZ)       ", c_naive, c_fast);
+    
+    asm volatile ("nop"); // Breakpoint 2: REV / UBFX
+    MEASURE(c_naive, naive_bswap32(data[i]));
+    MEASURE(c_fast, bit_bswap32(data[i]));
+    print_row("bswap32  (REV)       ", c_naive, c_fast);
+    
+    MEASURE(c_naive, naive_field(data[i], 8, 12) + naive_field(data[i], 20, 8));
+    MEASURE(c_fast, BIT_UBFX(data[i], 8, 12) + BIT_UBFX(data[i], 20, 8));
+    print_row("field x2 (UBFX)      ", c_naive, c_fast);
+    
+    asm volatile ("nop"); // Breakpoint 3: 비트맵 할당기
+    uint32_t start = dwt_cycles();
+    int ok = bitmap_round(bitmap_alloc_naive);
+    c_naive = dwt_elapsed(start);
+    start = dwt_cycles();
+    ok &= bitmap_round(bitmap_alloc);
+    c_fast = dwt_elapsed(start);
+    print_string("bitmap   (");
+    print_number(BITMAP_ROUND_ALLOCS, 3);
+    print_row(" allocs)", c_naive, c_fast);
+    check("bitmap allocator (naive / CLZ agree)", ok);
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 비트 조작 라이브러리 ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    
+    fill_data();
+    
+    print_string("\n결과 검증 (단순 반복문 버전과 비교):\n");
+    verify();
+    
+    print_string("\nctz(0x00010000) = ");
+    print_hex(bit_ctz(0x00010000));
+    print_string("bswap32(0x11223344) = ");
+    print_hex(bit_bswap32(0x11223344));
+    
+    benchmark();
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+    return 0;
+}
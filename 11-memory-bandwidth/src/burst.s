@@ -0,0 +1,59 @@
+/*
+ * LDM/STM 버스트 전송 커널
+ * 한 번에 레지스터 8개(32바이트)를 읽고 씀 - bytes 는 32의 배수
+ */
+
+    .syntax unified
+    .thumb
+
+/* uint32_t burst_read(const void *src, uint32_t bytes) - 읽은 값의 XOR 반환 */
+    .text
+    .thumb_func
+    .global burst_read
+burst_read:
+    push    {r4-r11}
+    movs    r12, #0
+1:
+    ldmia   r0!, {r2-r9}
+    eor     r12, r12, r2
+    eor     r12, r12, r9
+    subs    r1, r1, #32
+    bhi     1b
+    mov     r0, r12
+    pop     {r4-r11}
+    bx      lr
+
+/* void burst_copy(void *dst, const void *src, uint32_t bytes) */
+    .text
+    .thumb_func
+    .global burst_copy
+burst_copy:
+    push    {r4-r11}
+1:
+    ldmia   r1!, {r3-r10}
+    stmia   r0!, {r3-r10}
+    subs    r2, r2, #32
+    bhi     1b
+    pop     {r4-r11}
+    bx      lr
+
+/* void burst_fill(void *dst, uint32_t value, uint32_t bytes) */
+    .text
+    .thumb_func
+    .global burst_fill
+burst_fill:
+    push    {r4-r11}
+    mov     r3, r1
+    mov     r4, r1
+    mov     r5, r1
+    mov     r6, r1
+    mov     r7, r1
+    mov     r8, r1
+    mov     r9, r1
+    mov     r10, r1
+1:
+    stmia   r0!, {r3-r10}
+    subs    r2, r2, #32
+    bhi     1b
+    pop     {r4-r11}
+    bx      lr
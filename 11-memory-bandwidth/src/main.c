@@ -0,0 +1,215 @@
+/*
+ * Cortex-M33 메모리 대역폭 벤치마크
+ * 배치(코드 영역 / SRAM) x 크기 x 접근 패턴별 바이트/사이클 표
+ */
+
+#include <stdint.h>
+#include "report.h"
+#include "dwt.h"
+
+#define BUFFER_BYTES    (32 * 1024)
+#define BUFFER_WORDS    (BUFFER_BYTES / 4)
+#define TARGET_BYTES    (64 * 1024)     /* 측정마다 최소 이만큼 접근 (작은 버퍼는 반복) */
+#define CHASE_STRIDE    32              /* 포인터 체이스 원소 간격 (바이트) */
+
+/* 두 배치: 링커 스크립트의 S_CODE_BOOT(.bss) 와 SRAM(.sram) */
+static uint32_t code_buffer[BUFFER_WORDS] __attribute__((aligned(32)));
+static uint32_t sram_buffer[BUFFER_WORDS] __attribute__((aligned(32), section(".sram")));
+
+uint32_t burst_read(const void *src, uint32_t bytes);
+void burst_copy(void *dst, const void *src, uint32_t bytes);
+void burst_fill(void *dst, uint32_t value, uint32_t bytes);
+
+// ========== 접근 패턴 커널 ==========
+
+static volatile uint32_t sink;
+
+/* 순차 읽기: 워드 4개씩 펼친 LDR */
+static uint32_t read_sequential(const uint32_t *p, uint32_t words) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < words; i += 4) {
+        sum += p[i] + p[i + 1] + p[i + 2] + p[i + 3];
+    }
+    return sum;
+}
+
+/* 스트라이드 읽기: stride 바이트마다 워드 하나 */
+static uint32_t read_strided(const uint32_t *p, uint32_t words, uint32_t stride_words) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < words; i += stride_words) {
+        sum += p[i];
+    }
+    return sum;
+}
+
+/* 순차 쓰기: STR */
+static void write_sequential(uint32_t *p, uint32_t words) {
+    for (uint32_t i = 0; i < words; i += 4) {
+        p[i] = i;
+        p[i + 1] = i;
+        p[i + 2] = i;
+        p[i + 3] = i;
+    }
+}
+
+/*
+ * 포인터 체이스: 각 원소가 다음 원소의 주소를 담고 있어 로드가 직렬화됨
+ * (다음 주소를 알기 전에는 다음 로드를 시작할 수 없음 -> 지연시간 측정)
+ */
+static uint32_t lcg_state = 0xBEEF;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void build_chase(uint32_t *p, uint32_t bytes) {
+    uint32_t step = CHASE_STRIDE / 4;
+    uint32_t n = bytes / CHASE_STRIDE;
+    
+    /* Sattolo 셔플: 하나의 큰 사이클인 무작위 순열 -> 모든 원소를 한 번씩 방문 */
+    for (uint32_t i = 0; i < n; i++) {
+        p[i * step] = i;
+    }
+    for (uint32_t i = n - 1; i > 0; i--) {
+        uint32_t j = lcg_next() % i;
+        uint32_t t = p[i * step];
+        p[i * step] = p[j * step];
+        p[j * step] = t;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        p[i * step] = (uint32_t)&p[p[i * step] * step];
+    }
+}
+
+static uint32_t chase(const uint32_t *p, uint32_t hops) {
+    const uint32_t *q = p;
+    for (uint32_t i = 0; i < hops; i++) {
+        q = (const uint32_t *)*q;
+    }
+    return (uint32_t)q;
+}
+
+// ========== 측정 및 표 출력 ==========
+
+typedef struct {
+    const char *name;
+    uint32_t *base;
+} region_t;
+
+static void print_row(const char *region, const char *pattern, uint32_t size,
+                      uint32_t stride, uint32_t bytes, uint32_t cycles) {
+    /* 바이트/사이클 x100 (오버플로 방지를 위해 64비트) */
+    uint32_t bpc = cycles ? (uint32_t)((uint64_t)bytes * 100u / cycles) : 0;
+    
+    print_padded(region, 6);
+    print_padded(pattern, 12);
+    print_number(size, 7);
+    print_number(stride, 7);
+    print_number(bytes, 9);
+    print_number(cycles, 10);
+    print_number(bpc / 100, 6);
+    print_string(".");
+    print_number((bpc % 100) / 10, 1);
+    print_number(bpc % 10, 1);
+    print_string("\n");
+}
+
+static void bench_region(const region_t *r) {
+    static const uint32_t sizes[] = { 1024, 4096, 16384, BUFFER_BYTES };
+    static const uint32_t strides[] = { 16, 64, 256 };
+    uint32_t start, cycles, reps;
+    
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t size = sizes[s];
+        uint32_t words = size / 4;
+        reps = TARGET_BYTES / size;
+        
+        start = dwt_cycles();
+        for (uint32_t k = 0; k < reps; k++) {
+            sink = read_sequential(r->base, words);
+        }
+        cycles = dwt_elapsed(start);
+        print_row(r->name, "seq-read", size, 4, size * reps, cycles);
+        
+        start = dwt_cycles();
+        for (uint32_t k = 0; k < reps; k++) {
+            write_sequential(r->base, words);
+        }
+        cycles = dwt_elapsed(start);
+        print_row(r->name, "seq-write", size, 4, size * reps, cycles);
+        
+        for (unsigned t = 0; t < sizeof(strides) / sizeof(strides[0]); t++) {
+            uint32_t stride = strides[t];
+            uint32_t accesses = size / stride;
+            uint32_t sreps = TARGET_BYTES / (accesses * 4);   /* 접근 바이트 수를 맞춤 */
+            start = dwt_cycles();
+            for (uint32_t k = 0; k < sreps; k++) {
+                sink = read_strided(r->base, words, stride / 4);
+            }
+            cycles = dwt_elapsed(start);
+            print_row(r->name, "strided", size, stride, accesses * 4 * sreps, cycles);
+        }
+        
+        build_chase(r->base, size);
+        uint32_t hops = TARGET_BYTES / 4;
+        start = dwt_cycles();
+        sink = chase(r->base, hops);
+        cycles = dwt_elapsed(start);
+        print_row(r->name, "ptr-chase", size, CHASE_STRIDE, hops * 4, cycles);
+        
+        start = dwt_cycles();
+        for (uint32_t k = 0; k < reps; k++) {
+            sink = burst_read(r->base, size);
+        }
+        cycles = dwt_elapsed(start);
+        print_row(r->name, "ldm-read", size, 4, size * reps, cycles);
+        
+        start = dwt_cycles();
+        for (uint32_t k = 0; k < reps; k++) {
+            burst_fill(r->base, k, size);
+        }
+        cycles = dwt_elapsed(start);
+        print_row(r->name, "stm-fill", size, 4, size * reps, cycles);
+    }
+}
+
+static void bench_copy(void) {
+    uint32_t start, cycles;
+    
+    /* 배치 간 복사: 읽기 + 쓰기 바이트 모두 셈 */
+    start = dwt_cycles();
+    burst_copy(sram_buffer, code_buffer, BUFFER_BYTES);
+    cycles = dwt_elapsed(start);
+    print_row("c->s", "ldm/stm-cpy", BUFFER_BYTES, 4, 2 * BUFFER_BYTES, cycles);
+    
+    start = dwt_cycles();
+    burst_copy(code_buffer, sram_buffer, BUFFER_BYTES);
+    cycles = dwt_elapsed(start);
+    print_row("s->c", "ldm/stm-cpy", BUFFER_BYTES, 4, 2 * BUFFER_BYTES, cycles);
+}
+
+int main(void) {
+    static const region_t regions[] = {
+        { "code", code_buffer },
+        { "sram", sram_buffer },
+    };
+    
+    print_string("=== Cortex-M33 메모리 대역폭 벤치마크 ===\n");
+    dwt_init();
+    print_string(dwt_use_timer ? "사이클 소스: Dual Timer 1 (DWT 미구현 - QEMU)\n"
+                               : "사이클 소스: DWT CYCCNT\n");
+    print_string("code = S_CODE_BOOT .bss (0x1000xxxx), sram = 보안 SRAM (0x3000xxxx)\n\n");
+    
+    print_string("where pattern        size stride    bytes    cycles  B/cyc\n");
+    print_string("-----------------------------------------------------------\n");
+    for (unsigned i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+        asm volatile ("nop"); // Breakpoint 1: 배치별 측정 시작 (regions[i].base 확인)
+        bench_region(&regions[i]);
+    }
+    bench_copy();
+    
+    print_string("\n메모리 벤치마크 완료\n");
+    exit_program(0);
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * 레이아웃별 작업 커널
+ * 세 버전은 같은 일을 하며 메모리 배치만 다름 -> 결과가 같아야 함
+ */
+
+#include "layout.h"
+
+// ========== 레이아웃 변환 ==========
+
+void layout_to_soa(const record_t *aos, record_soa_t *soa) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        soa->address[i] = aos[i].address;
+        soa->size[i] = aos[i].size;
+        soa->id[i] = aos[i].id;
+        soa->flags[i] = aos[i].flags;
+        soa->timestamp[i] = aos[i].timestamp;
+        for (int k = 0; k < TAG_LEN; k++) {
+            soa->tag[i][k] = aos[i].tag[k];
+        }
+    }
+}
+
+void layout_to_split(const record_t *aos, record_split_t *split) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        split->hot[i].address = aos[i].address;
+        split->hot[i].size = aos[i].size;
+        split->hot[i].flags = aos[i].flags;
+        split->hot[i].id = aos[i].id;
+        split->cold[i].timestamp = aos[i].timestamp;
+        for (int k = 0; k < TAG_LEN; k++) {
+            split->cold[i].tag[k] = aos[i].tag[k];
+        }
+    }
+}
+
+// ========== scan ==========
+// AoS: 32바이트마다 4바이트만 사용, SoA: 연속 4바이트, split: 16바이트마다 4바이트
+
+int32_t aos_scan(const record_t *r) {
+    int32_t total = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        total += r[i].size;
+    }
+    return total;
+}
+
+int32_t soa_scan(const record_soa_t *r) {
+    int32_t total = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        total += r->size[i];
+    }
+    return total;
+}
+
+int32_t split_scan(const record_split_t *r) {
+    int32_t total = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        total += r->hot[i].size;
+    }
+    return total;
+}
+
+// ========== filter ==========
+
+int aos_filter(const record_t *r, int32_t min_size, uint16_t *out) {
+    int count = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if ((r[i].flags & FLAG_FREE) && r[i].size >= min_size) {
+            out[count++] = (uint16_t)i;
+        }
+    }
+    return count;
+}
+
+int soa_filter(const record_soa_t *r, int32_t min_size, uint16_t *out) {
+    int count = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if ((r->flags[i] & FLAG_FREE) && r->size[i] >= min_size) {
+            out[count++] = (uint16_t)i;
+        }
+    }
+    return count;
+}
+
+int split_filter(const record_split_t *r, int32_t min_size, uint16_t *out) {
+    int count = 0;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if ((r->hot[i].flags & FLAG_FREE) && r->hot[i].size >= min_size) {
+            out[count++] = (uint16_t)i;
+        }
+    }
+    return count;
+}
+
+// ========== update ==========
+
+void aos_update(record_t *r, uint32_t delta) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if (!(r[i].flags & FLAG_PINNED)) {
+            r[i].address += delta;
+        }
+    }
+}
+
+void soa_update(record_soa_t *r, uint32_t delta) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if (!(r->flags[i] & FLAG_PINNED)) {
+            r->address[i] += delta;
+        }
+    }
+}
+
+void split_update(record_split_t *r, uint32_t delta) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if (!(r->hot[i].flags & FLAG_PINNED)) {
+            r->hot[i].address += delta;
+        }
+    }
+}
+
+// ========== lookup ==========
+// AoS: 레코드 하나가 연속 32바이트, SoA: 필드마다 다른 배열 6곳, split: 두 곳
+
+static uint32_t tag_sum(const char *tag) {
+    uint32_t sum = 0;
+    for (int k = 0; k < TAG_LEN; k++) {
+        sum = sum * 31 + (uint8_t)tag[k];
+    }
+    return sum;
+}
+
+uint32_t aos_lookup(const record_t *r, const uint16_t *idx, int count) {
+    uint32_t sum = 0;
+    for (int n = 0; n < count; n++) {
+        const record_t *p = &r[idx[n]];
+        sum += p->address ^ (uint32_t)p->size ^ p->id ^ p->flags ^ p->timestamp;
+        sum += tag_sum(p->tag);
+    }
+    return sum;
+}
+
+uint32_t soa_lookup(const record_soa_t *r, const uint16_t *idx, int count) {
+    uint32_t sum = 0;
+    for (int n = 0; n < count; n++) {
+        int i = idx[n];
+        sum += r->address[i] ^ (uint32_t)r->size[i] ^ r->id[i] ^ r->flags[i] ^ r->timestamp[i];
+        sum += tag_sum(r->tag[i]);
+    }
+    return sum;
+}
+
+uint32_t split_lookup(const record_split_t *r, const uint16_t *idx, int count) {
+    uint32_t sum = 0;
+    for (int n = 0; n < count; n++) {
+        const record_hot_t *h = &r->hot[idx[n]];
+        const record_cold_t *c = &r->cold[idx[n]];
+        sum += h->address ^ (uint32_t)h->size ^ h->id ^ h->flags ^ c->timestamp;
+        sum += tag_sum(c->tag);
+    }
+    return sum;
+}
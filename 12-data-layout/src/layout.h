@@ -0,0 +1,81 @@
+/*
+ * 같은 레코드 집합을 세 가지 레이아웃으로 저장
+ *   AoS       : 레코드 하나가 연속 (04-heap-implementation 의 allocation_info_t 방식)
+ *   SoA       : 필드마다 배열 하나 (07-variables 의 addresses[] / names[] 방식)
+ *   hot/cold  : 자주 쓰는 필드와 드물게 쓰는 필드를 나눈 두 AoS
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+
+#define RECORD_COUNT    512
+#define TAG_LEN         12
+
+#define FLAG_FREE       0x1u
+#define FLAG_PINNED     0x2u
+
+/* AoS: 32바이트 레코드 */
+typedef struct {
+    uint32_t address;
+    int32_t  size;
+    uint32_t id;
+    uint32_t flags;
+    uint32_t timestamp;         /* cold: 조회할 때만 사용 */
+    char     tag[TAG_LEN];      /* cold */
+} record_t;
+
+/* SoA: 필드별 배열 */
+typedef struct {
+    uint32_t address[RECORD_COUNT];
+    int32_t  size[RECORD_COUNT];
+    uint32_t id[RECORD_COUNT];
+    uint32_t flags[RECORD_COUNT];
+    uint32_t timestamp[RECORD_COUNT];
+    char     tag[RECORD_COUNT][TAG_LEN];
+} record_soa_t;
+
+/* hot/cold 분리: scan/filter/update 가 쓰는 필드만 16바이트 hot 레코드에 */
+typedef struct {
+    uint32_t address;
+    int32_t  size;
+    uint32_t flags;
+    uint32_t id;
+} record_hot_t;
+
+typedef struct {
+    uint32_t timestamp;
+    char     tag[TAG_LEN];
+} record_cold_t;
+
+typedef struct {
+    record_hot_t  hot[RECORD_COUNT];
+    record_cold_t cold[RECORD_COUNT];
+} record_split_t;
+
+/* 레이아웃 변환 (AoS 가 원본) */
+void layout_to_soa(const record_t *aos, record_soa_t *soa);
+void layout_to_split(const record_t *aos, record_split_t *split);
+
+/* scan: 사용 중인 크기의 합 (필드 1개 읽기) */
+int32_t aos_scan(const record_t *r);
+int32_t soa_scan(const record_soa_t *r);
+int32_t split_scan(const record_split_t *r);
+
+/* filter: flags & FREE 이고 size >= min_size 인 레코드 인덱스 수집 (필드 2개 읽기) */
+int aos_filter(const record_t *r, int32_t min_size, uint16_t *out);
+int soa_filter(const record_soa_t *r, int32_t min_size, uint16_t *out);
+int split_filter(const record_split_t *r, int32_t min_size, uint16_t *out);
+
+/* update: 고정되지 않은 레코드의 address 를 delta 만큼 이동 (필드 2개 읽기 + 1개 쓰기) */
+void aos_update(record_t *r, uint32_t delta);
+void soa_update(record_soa_t *r, uint32_t delta);
+void split_update(record_split_t *r, uint32_t delta);
+
+/* lookup: 인덱스 목록의 레코드 전체 필드 체크섬 (무작위 접근, 모든 필드) */
+uint32_t aos_lookup(const record_t *r, const uint16_t *idx, int count);
+uint32_t soa_lookup(const record_soa_t *r, const uint16_t *idx, int count);
+uint32_t split_lookup(const record_split_t *r, const uint16_t *idx, int count);
+
+#endif /* LAYOUT_H */
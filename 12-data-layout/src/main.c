@@ -0,0 +1,232 @@
+/*
+ * Cortex-M33 데이터 레이아웃 실습 예제
+ * 같은 레코드 집합을 AoS / SoA / hot-cold 분리로 저장하고 작업별 사이클 비교
+ */
+
+#include <stdint.h>
+#include "layout.h"
+#include "report.h"
+#include "dwt.h"
+
+#define ROUNDS          8       /* 작업마다 반복 횟수 */
+#define LOOKUP_COUNT    128     /* 무작위 조회 레코드 수 */
+#define MIN_FREE_SIZE   256     /* filter 기준 크기 */
+
+// ========== 테스트 데이터 ==========
+
+static record_t aos[RECORD_COUNT];
+static record_soa_t soa;
+static record_split_t split;
+
+static uint16_t hits_aos[RECORD_COUNT];
+static uint16_t hits_soa[RECORD_COUNT];
+static uint16_t hits_split[RECORD_COUNT];
+static uint16_t lookup_idx[LOOKUP_COUNT];
+
+static volatile uint32_t sink;
+static uint32_t lcg_state = 0x5EED;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void fill_records(void) {
+    uint32_t address = 0x20000000;
+    
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        uint32_t r = lcg_next();
+        record_t *p = &aos[i];
+        
+        p->address = address;
+        p->size = (int32_t)(8 + ((r >> 8) & 1023));
+        p->id = i;
+        p->flags = ((r >> 24) & 3) == 0 ? FLAG_FREE : 0;   /* 약 1/4 이 빈 블록 */
+        if (((r >> 26) & 7) == 0) {
+            p->flags |= FLAG_PINNED;
+        }
+        p->timestamp = r;
+        for (int k = 0; k < TAG_LEN; k++) {
+            p->tag[k] = (char)('a' + (r >> k) % 26);
+        }
+        address += (uint32_t)p->size;
+    }
+    for (int n = 0; n < LOOKUP_COUNT; n++) {
+        lookup_idx[n] = (uint16_t)((lcg_next() >> 16) % RECORD_COUNT);
+    }
+    
+    layout_to_soa(aos, &soa);
+    layout_to_split(aos, &split);
+}
+
+// ========== 결과 검증 ==========
+
+static int same_hits(int n_aos, int n_soa, int n_split) {
+    if (n_aos != n_soa || n_aos != n_split) {
+        return 0;
+    }
+    for (int i = 0; i < n_aos; i++) {
+        if (hits_aos[i] != hits_soa[i] || hits_aos[i] != hits_split[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int same_addresses(void) {
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if (aos[i].address != soa.address[i] || aos[i].address != split.hot[i].address) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void verify(void) {
+    int32_t s = aos_scan(aos);
+    check("scan   (세 레이아웃 합계 일치)", s == soa_scan(&soa) && s == split_scan(&split));
+    
+    int n = aos_filter(aos, MIN_FREE_SIZE, hits_aos);
+    check("filter (인덱스 목록 일치)",
+          same_hits(n, soa_filter(&soa, MIN_FREE_SIZE, hits_soa),
+                    split_filter(&split, MIN_FREE_SIZE, hits_split)));
+    
+    aos_update(aos, 0x40);
+    soa_update(&soa, 0x40);
+    split_update(&split, 0x40);
+    check("update (address 일치)", same_addresses());
+    
+    uint32_t c = aos_lookup(aos, lookup_idx, LOOKUP_COUNT);
+    check("lookup (체크섬 일치)",
+          c == soa_lookup(&soa, lookup_idx, LOOKUP_COUNT) &&
+          c == split_lookup(&split, lookup_idx, LOOKUP_COUNT));
+}
+
+// ========== 레이아웃 정보 ==========
+
+static void print_layout(void) {
+    print_string("\n레이아웃 크기 (레코드 ");
+    print_number(RECORD_COUNT, 0);
+    print_string("개):\n");
+    print_string("  AoS   record_t       ");
+    print_number(sizeof(record_t), 3);
+    print_string(" B/레코드, 합계 ");
+    print_number(sizeof(aos), 6);
+    print_string(" B\n");
+    print_string("  SoA   record_soa_t         필드별 배열, 합계 ");
+    print_number(sizeof(soa), 6);
+    print_string(" B\n");
+    print_string("  split record_hot_t   ");
+    print_number(sizeof(record_hot_t), 3);
+    print_string(" B + record_cold_t ");
+    print_number(sizeof(record_cold_t), 0);
+    print_string(" B, 합계 ");
+    print_number(sizeof(split), 6);
+    print_string(" B\n");
+    
+    asm volatile ("nop"); // Breakpoint 1: 같은 필드(size)의 레코드 간 간격 확인
+    print_string("  size 필드 간격: AoS ");
+    print_number((uint32_t)&aos[1].size - (uint32_t)&aos[0].size, 0);
+    print_string(" B, SoA ");
+    print_number((uint32_t)&soa.size[1] - (uint32_t)&soa.size[0], 0);
+    print_string(" B, split ");
+    print_number((uint32_t)&split.hot[1].size - (uint32_t)&split.hot[0].size, 0);
+    print_string(" B\n");
+}
+
+// ========== 벤치마크 ==========
+
+static void print_ratio(uint32_t base, uint32_t value) {
+    uint32_t ratio = value ? base * 100u / value : 0;
+    
+    print_number(ratio / 100, 6);
+    print_string(".");
+    print_number((ratio % 100) / 10, 1);
+    print_number(ratio % 10, 1);
+    print_string("x");
+}
+
+static void print_row(const char *name, uint32_t c_aos, uint32_t c_soa, uint32_t c_split) {
+    print_string(name);
+    print_number(c_aos, 9);
+    print_number(c_soa, 9);
+    print_number(c_split, 9);
+    print_ratio(c_aos, c_soa);
+    print_ratio(c_aos, c_split);
+    print_string("\n");
+}
+
+#define MEASURE(result, expr)                       \
+    do {                                            \
+        uint32_t start_ = dwt_cycles();             \
+        for (int k = 0; k < ROUNDS; k++) {          \
+            sink = (uint32_t)(expr);                \
+        }                                           \
+        (result) = dwt_elapsed(start_);             \
+    } while (0)
+
+#define MEASURE_VOID(result, stmt)                  \
+    do {                                            \
+        uint32_t start_ = dwt_cycles();             \
+        for (int k = 0; k < ROUNDS; k++) {          \
+            stmt;                                   \
+        }                                           \
+        (result) = dwt_elapsed(start_);             \
+    } while (0)
+
+static void benchmark(void) {
+    uint32_t c_aos, c_soa, c_split;
+    
+    print_string("\nworkload (x8)         aos      soa    split   soa/aos split/aos\n");
+    print_string("---------------------------------------------------------------\n");
+    
+    asm volatile ("nop"); // Breakpoint 2: scan / filter (hot 필드만)
+    MEASURE(c_aos, aos_scan(aos));
+    MEASURE(c_soa, soa_scan(&soa));
+    MEASURE(c_split, split_scan(&split));
+    print_row("scan   (1 필드) ", c_aos, c_soa, c_split);
+    
+    MEASURE(c_aos, aos_filter(aos, MIN_FREE_SIZE, hits_aos));
+    MEASURE(c_soa, soa_filter(&soa, MIN_FREE_SIZE, hits_soa));
+    MEASURE(c_split, split_filter(&split, MIN_FREE_SIZE, hits_split));
+    print_row("filter (2 필드) ", c_aos, c_soa, c_split);
+    
+    MEASURE_VOID(c_aos, aos_update(aos, 4));
+    MEASURE_VOID(c_soa, soa_update(&soa, 4));
+    MEASURE_VOID(c_split, split_update(&split, 4));
+    print_row("update (2R+1W)  ", c_aos, c_soa, c_split);
+    
+    asm volatile ("nop"); // Breakpoint 3: lookup (무작위, 모든 필드)
+    MEASURE(c_aos, aos_lookup(aos, lookup_idx, LOOKUP_COUNT));
+    MEASURE(c_soa, soa_lookup(&soa, lookup_idx, LOOKUP_COUNT));
+    MEASURE(c_split, split_lookup(&split, lookup_idx, LOOKUP_COUNT));
+    print_row("lookup (전 필드)", c_aos, c_soa, c_split);
+    
+    check("update 반복 후 address 일치", same_addresses());
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 데이터 레이아웃 (AoS / SoA / hot-cold) ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    
+    fill_records();
+    print_layout();
+    
+    print_string("\n결과 검증 (세 레이아웃 비교):\n");
+    verify();
+    
+    benchmark();
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+    return 0;
+}
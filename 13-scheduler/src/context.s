@@ -0,0 +1,31 @@
+/*
+ * PendSV 문맥 전환
+ *
+ * 하드웨어가 예외 진입 시 PSP 에 r0-r3, r12, lr, pc, xPSR 을 이미 저장했으므로
+ * 여기서는 나머지 r4-r11 과 EXC_RETURN(lr) 만 저장/복원합니다.
+ *
+ *   [새 PSP] r4 r5 r6 r7 r8 r9 r10 r11 EXC_RETURN | r0 r1 r2 r3 r12 lr pc xPSR
+ *             <---- 소프트웨어 (여기) ---->         <------ 하드웨어 ------>
+ *
+ * FPU 는 사용하지 않음 (소프트 float 빌드, CONTROL.FPCA = 0 -> 확장 프레임 없음)
+ */
+
+    .syntax unified
+    .thumb
+    .text
+
+    .thumb_func
+    .global PendSV_Handler
+    .type PendSV_Handler, %function
+PendSV_Handler:
+    mrs     r0, psp
+    stmdb   r0!, {r4-r11, lr}       /* 현재 태스크 문맥 저장 */
+
+    cpsid   i                       /* SysTick 이 준비 목록을 바꾸지 못하게 */
+    bl      sched_switch            /* r0 = 저장된 PSP -> r0 = 다음 태스크 PSP (PSPLIM 설정 포함) */
+    cpsie   i
+
+    ldmia   r0!, {r4-r11, lr}       /* 다음 태스크 문맥 복원 */
+    msr     psp, r0
+    bx      lr                      /* EXC_RETURN: 스레드 모드 + PSP 로 하드웨어 프레임 복원 */
+    .size PendSV_Handler, .-PendSV_Handler
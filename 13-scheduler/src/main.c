@@ -0,0 +1,248 @@
+/*
+ * Cortex-M33 스케줄러 실습 예제
+ * PendSV 문맥 전환 + SysTick 타임 슬라이스 + CLZ 우선순위 비트맵
+ */
+
+#include <stdint.h>
+#include "sched.h"
+#include "report.h"
+#include "dwt.h"
+
+#define PINGPONG_ROUNDS 200
+#define PINGPONG_SWITCHES (2 * PINGPONG_ROUNDS)   /* 두 태스크가 각각 ROUNDS 번 yield */
+#define WAKE_SAMPLES    32
+#define SLICE_TICKS     20      /* 타임 슬라이스 데모 길이 (tick) */
+#define SAMPLE_PERIOD   5
+
+#define PRIO_SUPERVISOR 6
+#define PRIO_PINGPONG   4
+#define PRIO_SAMPLER    3
+#define PRIO_WORKER     2
+
+// ========== 1. yield 핑퐁: 문맥 전환 지연 ==========
+
+static task_t ping_task, pong_task;
+static volatile uint32_t pp_stamp;
+static volatile int pp_turn;
+static volatile int pp_done;
+static stats_t pp_stats;
+static uint32_t pp_skipped;
+
+static void pingpong_entry(void *arg) {
+    int id = (int)arg;
+    
+    for (int i = 0; i < PINGPONG_ROUNDS; i++) {
+        /* 상대가 yield 로 넘겨준 경우만 측정 (SysTick 타임 슬라이스로 넘어온 경우 제외) */
+        if (pp_turn == id && pp_stamp) {
+            stats_add(&pp_stats, dwt_elapsed(pp_stamp));
+        } else if (pp_stamp) {
+            pp_skipped++;
+        }
+        pp_turn = !id;
+        pp_stamp = dwt_cycles();
+        sched_yield();
+    }
+    pp_done++;
+}
+
+// ========== 2. SysTick -> 깨어난 태스크 지연 ==========
+
+static stats_t wake_stats;
+
+static void measure_wake_latency(void) {
+    for (int i = 0; i < WAKE_SAMPLES; i++) {
+        sched_sleep(1);
+        /* SysTick_Handler 진입 시각부터 이 태스크가 다시 실행될 때까지 */
+        stats_add(&wake_stats, dwt_elapsed(sched_tick_stamp));
+    }
+}
+
+// ========== 3. 타임 슬라이스 데모 ==========
+
+static task_t worker_a, worker_b, sampler_task;
+static volatile uint32_t work_count[2];
+static volatile uint32_t slice_end;
+static volatile int slice_done;
+static int slice_ok = 1;
+
+static void worker_entry(void *arg) {
+    int id = (int)arg;
+    
+    /* yield 없이 계속 실행 -> 같은 우선순위끼리는 SysTick 이 번갈아 실행시킴 */
+    while ((int32_t)(sched_ticks() - slice_end) < 0) {
+        work_count[id]++;
+    }
+    slice_done++;
+}
+
+static void sampler_entry(void *arg) {
+    uint32_t last[2] = { 0, 0 };
+    (void)arg;
+    
+    print_string("  tick   worker A   worker B\n");
+    for (int i = 0; i < SLICE_TICKS / SAMPLE_PERIOD; i++) {
+        sched_sleep(SAMPLE_PERIOD);     /* 더 높은 우선순위 -> 깨어나면 워커를 선점 */
+        uint32_t a = work_count[0], b = work_count[1];
+        print_number(sched_ticks(), 6);
+        print_number(a, 11);
+        print_number(b, 11);
+        print_string("\n");
+        /* 구간마다 두 워커가 모두 진행해야 함 */
+        slice_ok &= a > last[0] && b > last[1];
+        last[0] = a;
+        last[1] = b;
+    }
+    slice_done++;
+}
+
+// ========== 4. 최고 우선순위 선택: CLZ vs 선형 탐색 ==========
+
+static volatile uint32_t sink;
+
+__attribute__((noinline)) int pick_scan(uint32_t bitmap) {
+    for (int p = SCHED_PRIORITIES - 1; p > 0; p--) {
+        if (bitmap & (1u << p)) return p;
+    }
+    return 0;
+}
+
+__attribute__((noinline)) int pick_clz(uint32_t bitmap) {
+    return 31 - __builtin_clz(bitmap | 1);
+}
+
+static void benchmark_pick(void) {
+    static const uint32_t bitmaps[] = { 0x00000001u, 0x00000005u, 0x00000105u, 0x80000001u };
+    uint32_t start, c_scan, c_clz;
+    int ok = 1;
+    
+    for (unsigned i = 0; i < sizeof(bitmaps) / sizeof(bitmaps[0]); i++) {
+        ok &= pick_scan(bitmaps[i]) == pick_clz(bitmaps[i]);
+    }
+    check("pick_clz == pick_scan", ok);
+    
+    print_string("\nhighest ready (x256)        scan       clz   speedup\n");
+    print_string("----------------------------------------------------\n");
+    for (unsigned i = 0; i < sizeof(bitmaps) / sizeof(bitmaps[0]); i++) {
+        start = dwt_cycles();
+        for (int k = 0; k < 256; k++) sink = pick_scan(bitmaps[i]);
+        c_scan = dwt_elapsed(start);
+        start = dwt_cycles();
+        for (int k = 0; k < 256; k++) sink = pick_clz(bitmaps[i]);
+        c_clz = dwt_elapsed(start);
+        
+        uint32_t ratio = c_clz ? c_scan * 100u / c_clz : 0;
+        print_string("  top priority ");
+        print_number(pick_clz(bitmaps[i]), 2);
+        print_number(c_scan, 15);
+        print_number(c_clz, 10);
+        print_number(ratio / 100, 6);
+        print_string(".");
+        print_number((ratio % 100) / 10, 1);
+        print_number(ratio % 10, 1);
+        print_string("x\n");
+    }
+}
+
+// ========== 감독 태스크 ==========
+
+static task_t supervisor_task;
+
+static void print_task(const task_t *t) {
+    int width = 12;
+    
+    print_string("  ");
+    print_string(t->name);
+    for (const char *p = t->name; *p; p++) {
+        width--;
+    }
+    while (width-- > 0) {
+        print_string(" ");
+    }
+    print_number(t->priority, 4);
+    print_number(t->stack_size, 8);
+    print_number(sched_stack_used(t), 8);
+    print_string("\n");
+}
+
+static void supervisor_entry(void *arg) {
+    (void)arg;
+    
+    asm volatile ("nop"); // Breakpoint 1: 첫 태스크 진입 (PSP, CONTROL.SPSEL 확인)
+    print_string("\n[1] yield 핑퐁 (같은 우선순위 두 태스크)\n");
+    sched_create(&ping_task, pingpong_entry, (void *)0, 512, PRIO_PINGPONG, "ping");
+    sched_create(&pong_task, pingpong_entry, (void *)1, 512, PRIO_PINGPONG, "pong");
+    while (pp_done < 2) {
+        sched_sleep(1);
+    }
+    
+    print_string("[2] SysTick -> 깨어난 태스크 지연\n");
+    measure_wake_latency();
+    
+    print_string("[3] 타임 슬라이스 (같은 우선순위 워커 2개, yield 없음)\n");
+    slice_end = sched_ticks() + SLICE_TICKS + 1;
+    sched_create(&worker_a, worker_entry, (void *)0, 256, PRIO_WORKER, "worker A");
+    sched_create(&worker_b, worker_entry, (void *)1, 256, PRIO_WORKER, "worker B");
+    sched_create(&sampler_task, sampler_entry, 0, 512, PRIO_SAMPLER, "sampler");
+    while (slice_done < 3) {
+        sched_sleep(1);
+    }
+    
+    asm volatile ("nop"); // Breakpoint 2: 데모 종료 (sched_current, ready_bitmap 확인)
+    print_string("\nlatency (cycles)              min     avg     max  samples\n");
+    print_string("----------------------------------------------------------\n");
+    print_stats("yield -> other task      ", 0, &pp_stats);
+    print_stats("SysTick -> woken task    ", 0, &wake_stats);
+    print_string("(time-slice handoffs skipped: ");
+    print_number(pp_skipped, 0);
+    print_string(")\n");
+    
+    benchmark_pick();
+    
+    print_string("\n  task        prio   stack    used\n");
+    print_task(&supervisor_task);
+    print_task(&ping_task);
+    print_task(&pong_task);
+    print_task(&worker_a);
+    print_task(&worker_b);
+    print_task(&sampler_task);
+    print_string("context switches: ");
+    print_number(sched_switch_count(), 0);
+    print_string(", ticks: ");
+    print_number(sched_ticks(), 0);
+    print_string("\n\n결과 검증:\n");
+    
+    check("yield 핑퐁 측정 (전환 400번 중 절반 이상)", pp_stats.count >= PINGPONG_SWITCHES / 2);
+    check("SysTick 깨우기 측정", wake_stats.count == WAKE_SAMPLES);
+    check("타임 슬라이스: 구간마다 두 워커 모두 진행", slice_ok);
+    check("스택 사용량 < 할당량 (PSPLIM 미도달)",
+          sched_stack_used(&ping_task) < ping_task.stack_size &&
+          sched_stack_used(&worker_a) < worker_a.stack_size &&
+          sched_stack_used(&sampler_task) < sampler_task.stack_size &&
+          sched_stack_used(&supervisor_task) < supervisor_task.stack_size);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 스케줄러 (PendSV + SysTick + CLZ) ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    
+    sched_init();
+    sched_create(&supervisor_task, supervisor_entry, 0, 1024, PRIO_SUPERVISOR, "supervisor");
+    
+    print_string("태스크 스택 영역 남은 크기: ");
+    print_number(sched_stack_free_total(), 0);
+    print_string(" bytes\n");
+    
+    sched_start();      /* 돌아오지 않음 */
+}
@@ -0,0 +1,303 @@
+/*
+ * 최소 선점형 스케줄러 구현
+ * 문맥 저장/복원은 context.s 의 PendSV_Handler, 다음 태스크 선택은 sched_switch()
+ */
+
+#include "sched.h"
+#include "dwt.h"
+
+#define SCB_ICSR            (*(volatile uint32_t *)0xE000ED04)
+#define SCB_SHPR3           (*(volatile uint32_t *)0xE000ED20)
+#define SYST_CSR            (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR            (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR            (*(volatile uint32_t *)0xE000E018)
+
+#define ICSR_PENDSVSET      (1u << 28)
+#define SYST_ENABLE_TICKINT_CPU 0x7u        /* ENABLE | TICKINT | CLKSOURCE=프로세서 클록 */
+
+#define STACK_PAINT         0xDEADBEEFu
+#define EXC_RETURN_THREAD_PSP 0xFFFFFFFDu   /* 스레드 모드, PSP, 기본 프레임 */
+#define XPSR_THUMB          0x01000000u
+
+/* 링커 스크립트 (.task_stacks, RAM 영역) */
+extern uint32_t __task_stack_start[];
+extern uint32_t __task_stack_end[];
+
+static task_t *ready_tail[SCHED_PRIORITIES];   /* 원형 목록의 꼬리, head = tail->next */
+static uint32_t ready_bitmap;                   /* 비트 p = 우선순위 p 에 준비된 태스크 있음 */
+static task_t *tasks[SCHED_MAX_TASKS];
+static int task_count;
+static uint32_t stack_next;
+static volatile uint32_t tick_count;
+static volatile uint32_t switch_count;
+
+/* context.s 가 참조 */
+task_t *sched_current;
+volatile uint32_t sched_tick_stamp;
+
+/* sched_start 전 main 문맥이 저장될 곳 (다시 실행되지 않음) */
+static task_t boot_task;
+static uint32_t boot_psp_area[16] __attribute__((aligned(8)));
+
+static task_t idle_task;
+
+// ========== 임계 구역 (PRIMASK) ==========
+
+static inline uint32_t irq_save(void) {
+    uint32_t primask;
+    __asm volatile ("mrs %0, primask\n cpsid i" : "=r"(primask) : : "memory");
+    return primask;
+}
+
+static inline void irq_restore(uint32_t primask) {
+    __asm volatile ("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+static inline void pend_switch(void) {
+    SCB_ICSR = ICSR_PENDSVSET;
+    __asm volatile ("dsb\n isb" : : : "memory");
+}
+
+// ========== 준비 목록 ==========
+
+static void ready_insert(task_t *t) {
+    task_t **tail = &ready_tail[t->priority];
+    
+    if (*tail == 0) {
+        t->next = t;
+    } else {
+        t->next = (*tail)->next;
+        (*tail)->next = t;
+    }
+    *tail = t;
+    ready_bitmap |= 1u << t->priority;
+}
+
+/* 목록에서 t 제거 (같은 우선순위 태스크 수만큼만 탐색) */
+static void ready_remove(task_t *t) {
+    task_t **tail = &ready_tail[t->priority];
+    task_t *prev = *tail;
+    
+    if (prev == 0) {
+        return;
+    }
+    while (prev->next != t) {
+        prev = prev->next;
+        if (prev == *tail) {
+            return;     /* 목록에 없음 */
+        }
+    }
+    if (prev == t) {
+        *tail = 0;      /* 유일한 태스크 */
+        ready_bitmap &= ~(1u << t->priority);
+        return;
+    }
+    prev->next = t->next;
+    if (*tail == t) {
+        *tail = prev;
+    }
+}
+
+/* head 를 꼬리로 보냄 -> 같은 우선순위의 다음 태스크가 head */
+static void ready_rotate(uint8_t priority) {
+    if (ready_tail[priority]) {
+        ready_tail[priority] = ready_tail[priority]->next;
+    }
+}
+
+int sched_highest_ready(void) {
+    return 31 - __builtin_clz(ready_bitmap);    /* idle(0) 이 항상 준비 -> bitmap != 0 */
+}
+
+uint32_t sched_ready_bitmap(void) {
+    return ready_bitmap;
+}
+
+// ========== 문맥 전환 (PendSV 에서 호출) ==========
+
+/* sp = 현재 태스크의 저장된 PSP, 반환 = 다음 태스크의 PSP */
+uint32_t sched_switch(uint32_t sp) {
+    task_t *next;
+    
+    sched_current->sp = sp;
+    next = ready_tail[sched_highest_ready()]->next;
+    if (next != sched_current) {
+        switch_count++;
+    }
+    sched_current = next;
+    
+    /* 새 태스크의 스택 한계 (넘으면 UsageFault STKOF) */
+    __asm volatile ("msr psplim, %0" : : "r"(next->stack_limit));
+    return next->sp;
+}
+
+void SysTick_Handler(void) {
+    uint32_t now;
+    int preempt = 0;
+    
+    sched_tick_stamp = dwt_cycles();
+    now = ++tick_count;
+    
+    /* 깨어날 태스크 */
+    for (int i = 0; i < task_count; i++) {
+        task_t *t = tasks[i];
+        if (t->state == TASK_SLEEPING && (int32_t)(now - t->wake_tick) >= 0) {
+            t->state = TASK_READY;
+            ready_insert(t);
+            preempt |= t->priority > sched_current->priority;
+        }
+    }
+    
+    /* 타임 슬라이스: 같은 우선순위에 다른 태스크가 있으면 회전 */
+    if (sched_current->state == TASK_READY && sched_current->next != sched_current &&
+        ready_tail[sched_current->priority]->next == sched_current) {
+        ready_rotate(sched_current->priority);
+        preempt = 1;
+    }
+    
+    if (preempt) {
+        pend_switch();
+    }
+}
+
+// ========== 태스크 API ==========
+
+static void task_exit(void) {
+    uint32_t primask = irq_save();
+    sched_current->state = TASK_DONE;
+    ready_remove(sched_current);
+    irq_restore(primask);
+    pend_switch();
+    while (1);      /* PendSV 가 다른 태스크로 전환 */
+}
+
+static void idle_entry(void *arg) {
+    (void)arg;
+    while (1) {
+        __asm volatile ("wfi");
+    }
+}
+
+void sched_init(void) {
+    stack_next = (uint32_t)__task_stack_start;
+    task_count = 0;
+    ready_bitmap = 0;
+    tick_count = 0;
+    switch_count = 0;
+    for (int p = 0; p < SCHED_PRIORITIES; p++) {
+        ready_tail[p] = 0;
+    }
+}
+
+int sched_create(task_t *task, task_entry_t entry, void *arg, uint32_t stack_bytes,
+                 uint8_t priority, const char *name) {
+    uint32_t *sp;
+    uint32_t primask;
+    
+    stack_bytes = (stack_bytes + 7) & ~7u;
+    if (priority >= SCHED_PRIORITIES || task_count >= SCHED_MAX_TASKS ||
+        stack_next + stack_bytes > (uint32_t)__task_stack_end) {
+        return -1;
+    }
+    
+    task->stack_base = stack_next;
+    task->stack_size = stack_bytes;
+    task->stack_limit = stack_next;
+    stack_next += stack_bytes;
+    
+    /* 사용량 측정용 패턴 */
+    for (uint32_t *p = (uint32_t *)task->stack_base; p < (uint32_t *)stack_next; p++) {
+        *p = STACK_PAINT;
+    }
+    
+    /* 첫 전환 때 PendSV 가 복원할 프레임: 하드웨어 프레임 8워드 + r4-r11, EXC_RETURN */
+    sp = (uint32_t *)stack_next;
+    *--sp = XPSR_THUMB;                 /* xPSR */
+    *--sp = (uint32_t)entry & ~1u;      /* PC */
+    *--sp = (uint32_t)task_exit;        /* LR: entry 가 반환하면 종료 */
+    *--sp = 0;                          /* r12 */
+    *--sp = 0;                          /* r3 */
+    *--sp = 0;                          /* r2 */
+    *--sp = 0;                          /* r1 */
+    *--sp = (uint32_t)arg;              /* r0 */
+    *--sp = EXC_RETURN_THREAD_PSP;      /* lr (EXC_RETURN) */
+    for (int r = 11; r >= 4; r--) {
+        *--sp = 0;                      /* r11..r4 */
+    }
+    
+    task->sp = (uint32_t)sp;
+    task->priority = priority;
+    task->name = name;
+    task->state = TASK_READY;
+    
+    primask = irq_save();
+    tasks[task_count++] = task;
+    ready_insert(task);
+    irq_restore(primask);
+    
+    /* 실행 중에 더 높은 우선순위 태스크를 만들면 즉시 전환 */
+    if (sched_current && sched_current != &boot_task && priority > sched_current->priority) {
+        pend_switch();
+    }
+    return 0;
+}
+
+void sched_start(void) {
+    sched_create(&idle_task, idle_entry, 0, 256, 0, "idle");
+    
+    /* PendSV 최저, SysTick 그 다음 (SHPR3: [23:16] PendSV, [31:24] SysTick) */
+    SCB_SHPR3 = (SCB_SHPR3 & 0x0000FFFFu) | (0xFFu << 16) | (0xC0u << 24);
+    
+    SYST_RVR = SCHED_CPU_HZ / SCHED_TICK_HZ - 1;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_ENABLE_TICKINT_CPU;
+    
+    /* main 문맥은 임시 PSP 영역에 저장되고 버려짐 */
+    __asm volatile ("msr psp, %0" : : "r"(&boot_psp_area[16]));
+    sched_current = &boot_task;
+    pend_switch();
+    
+    while (1);
+}
+
+void sched_yield(void) {
+    uint32_t primask = irq_save();
+    ready_rotate(sched_current->priority);
+    irq_restore(primask);
+    pend_switch();
+}
+
+void sched_sleep(uint32_t ticks) {
+    uint32_t primask = irq_save();
+    sched_current->wake_tick = tick_count + (ticks ? ticks : 1);
+    sched_current->state = TASK_SLEEPING;
+    ready_remove(sched_current);
+    irq_restore(primask);
+    pend_switch();
+}
+
+uint32_t sched_ticks(void) {
+    return tick_count;
+}
+
+task_t *sched_self(void) {
+    return sched_current;
+}
+
+uint32_t sched_switch_count(void) {
+    return switch_count;
+}
+
+uint32_t sched_stack_used(const task_t *task) {
+    const uint32_t *p = (const uint32_t *)task->stack_base;
+    const uint32_t *end = (const uint32_t *)(task->stack_base + task->stack_size);
+    
+    while (p < end && *p == STACK_PAINT) {
+        p++;
+    }
+    return (uint32_t)end - (uint32_t)p;
+}
+
+uint32_t sched_stack_free_total(void) {
+    return (uint32_t)__task_stack_end - stack_next;
+}
@@ -0,0 +1,67 @@
+/*
+ * 최소 선점형 스케줄러
+ *   - 태스크마다 PSP 스택 (링커 스크립트의 .task_stacks 영역에서 할당)
+ *   - PendSV 문맥 전환 (context.s), SysTick 타임 슬라이스
+ *   - 우선순위 비트맵 + CLZ 로 O(1) 최고 우선순위 선택
+ *
+ * 우선순위: 숫자가 클수록 높음 (0 = idle, 1..31 = 사용자 태스크)
+ * 같은 우선순위는 원형 목록에서 라운드 로빈 (sched_yield 또는 SysTick 마다 회전)
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+
+#define SCHED_PRIORITIES    32
+#define SCHED_MAX_TASKS     12
+#define SCHED_TICK_HZ       1000
+#define SCHED_CPU_HZ        25000000u       /* MPS2-AN505 SYSCLK */
+
+typedef enum {
+    TASK_READY,
+    TASK_SLEEPING,
+    TASK_DONE,
+} task_state_t;
+
+typedef struct task {
+    uint32_t sp;                /* 저장된 PSP (context.s 가 오프셋 0 을 사용) */
+    uint32_t stack_limit;       /* PSPLIM 값 (스택 바닥) */
+    struct task *next;          /* 같은 우선순위 준비 목록 (원형) */
+    task_state_t state;
+    uint8_t priority;
+    uint32_t wake_tick;
+    uint32_t stack_base;
+    uint32_t stack_size;
+    const char *name;
+} task_t;
+
+typedef void (*task_entry_t)(void *arg);
+
+void sched_init(void);
+
+/* stack_bytes 는 8의 배수로 올림. 스택 영역이 부족하면 -1 */
+int sched_create(task_t *task, task_entry_t entry, void *arg, uint32_t stack_bytes,
+                 uint8_t priority, const char *name);
+
+/* main 의 문맥을 버리고 첫 태스크로 전환 (돌아오지 않음) */
+void sched_start(void) __attribute__((noreturn));
+
+void sched_yield(void);
+void sched_sleep(uint32_t ticks);
+uint32_t sched_ticks(void);
+task_t *sched_self(void);
+
+/* 준비 비트맵에서 최고 우선순위 (31 - CLZ) */
+int sched_highest_ready(void);
+uint32_t sched_ready_bitmap(void);
+
+/* 통계 */
+uint32_t sched_switch_count(void);
+uint32_t sched_stack_used(const task_t *task);
+uint32_t sched_stack_free_total(void);
+
+/* SysTick 진입 시각 (벤치마크용, dwt_cycles 값) */
+extern volatile uint32_t sched_tick_stamp;
+
+#endif /* SCHED_H */
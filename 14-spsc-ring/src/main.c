@@ -0,0 +1,394 @@
+/*
+ * Cortex-M33 SPSC 링 버퍼 실습 예제
+ * 타이머 ISR(생산자) -> 스레드(소비자) 샘플 스트리밍 + 처리량/지연 벤치마크
+ */
+
+#include <stdint.h>
+#include "ring.h"
+#include "report.h"
+#include "dwt.h"
+
+#define RING_CAPACITY    64     /* 2의 거듭제곱 */
+#define SAMPLES_PER_IRQ  4
+#define SAMPLE_PERIOD    2500   /* Timer0 reload: 25MHz / 2500 = 10kHz */
+#define STREAM_SAMPLES   4096
+#define CONSUMER_BATCH   16
+#define BENCH_ITEMS      1024
+#define BENCH_CHUNK      32
+
+/* CMSDK Timer0 (Secure 별칭) - IRQ 3 */
+#define TIMER0_CTRL      (*(volatile uint32_t *)0x50000000)
+#define TIMER0_VALUE     (*(volatile uint32_t *)0x50000004)
+#define TIMER0_RELOAD    (*(volatile uint32_t *)0x50000008)
+#define TIMER0_INTCLEAR  (*(volatile uint32_t *)0x5000000C)
+#define TIMER0_IRQn      3
+#define NVIC_ISER0       (*(volatile uint32_t *)0xE000E100)
+#define NVIC_ICER0       (*(volatile uint32_t *)0xE000E180)
+
+// ========== 1. FIFO 순서 (랩어라운드 포함, 인터럽트 없음) ==========
+
+static ring_item_t ring_storage[RING_CAPACITY];
+static ring_t stream;
+
+static int verify_fifo(void) {
+    ring_item_t batch[24], item, *slot;
+    uint32_t next_in = 0, next_out = 0;
+    int ok = 1;
+    
+    ring_init(&stream, ring_storage, RING_CAPACITY);
+    
+    /* 단일/배치/제로 카피를 섞어 용량의 여러 배를 통과시킴 */
+    for (int round = 0; round < 3 * RING_CAPACITY / 8; round++) {
+        switch (round % 3) {
+        case 0:
+            for (int i = 0; i < 5; i++) {
+                item.seq = next_in++;
+                ok &= ring_push(&stream, &item);
+            }
+            break;
+        case 1:
+            for (int i = 0; i < 24; i++) {
+                batch[i].seq = next_in + i;
+            }
+            next_in += ring_push_batch(&stream, batch, 24);
+            break;
+        default: {
+            uint32_t n = ring_reserve(&stream, &slot);
+            if (n > 11) n = 11;
+            for (uint32_t i = 0; i < n; i++) {
+                slot[i].seq = next_in++;
+            }
+            ring_commit(&stream, n);
+            break;
+        }
+        }
+    
+        /* 소비 쪽도 방식을 바꿔가며 일부만 꺼냄 */
+        if (round & 1) {
+            uint32_t n = ring_pop_batch(&stream, batch, 13);
+            for (uint32_t i = 0; i < n; i++) {
+                ok &= batch[i].seq == next_out++;
+            }
+        } else {
+            uint32_t n = ring_peek(&stream, &slot);
+            for (uint32_t i = 0; i < n; i++) {
+                ok &= slot[i].seq == next_out++;
+            }
+            ring_release(&stream, n);
+        }
+    }
+    while (ring_pop(&stream, &item)) {
+        ok &= item.seq == next_out++;
+    }
+    
+    ok &= ring_count(&stream) == 0 && next_in == next_out && next_in > RING_CAPACITY;
+    /* 가득 찬 링은 거부 */
+    for (int i = 0; i < RING_CAPACITY; i++) {
+        ok &= ring_push(&stream, &item);
+    }
+    ok &= !ring_push(&stream, &item) && ring_free(&stream) == 0;
+    return ok;
+}
+
+// ========== 2. 타이머 ISR -> 스레드 스트리밍 ==========
+
+static volatile int producer_on;
+static volatile uint32_t producer_seq;
+static volatile uint32_t irq_count;
+static stats_t isr_stats;
+
+/* 생산자: IRQ 한 번에 SAMPLES_PER_IRQ 개를 링 안에 직접 씀 (reserve/commit) */
+void TIMER0_Handler(void) {
+    uint32_t now = dwt_cycles();
+    uint32_t seq = producer_seq;
+    uint32_t left = SAMPLES_PER_IRQ;
+    
+    TIMER0_INTCLEAR = 1;
+    irq_count++;
+    if (!producer_on) {
+        return;
+    }
+    
+    while (left) {
+        ring_item_t *slot;
+        uint32_t n = ring_reserve(&stream, &slot);
+        if (n == 0) {
+            /* 가득 참: 버리고 순번만 진행 -> 소비자가 빈 순번으로 유실을 확인 */
+            while (left--) {
+                ring_note_drop(&stream);
+                seq++;
+            }
+            break;
+        }
+        if (n > left) n = left;
+        for (uint32_t i = 0; i < n; i++) {
+            slot[i].seq = seq++;
+            slot[i].stamp = now;
+        }
+        ring_commit(&stream, n);
+        left -= n;
+    }
+    producer_seq = seq;
+    stats_add(&isr_stats, dwt_elapsed(now));
+}
+
+static void timer0_start(void) {
+    TIMER0_CTRL = 0;
+    TIMER0_RELOAD = SAMPLE_PERIOD - 1;
+    TIMER0_VALUE = SAMPLE_PERIOD - 1;
+    TIMER0_INTCLEAR = 1;
+    NVIC_ISER0 = 1u << TIMER0_IRQn;
+    TIMER0_CTRL = (1u << 3) | (1u << 0);    /* IRQ 허용 | 시작 */
+}
+
+static void timer0_stop(void) {
+    TIMER0_CTRL = 0;
+    NVIC_ICER0 = 1u << TIMER0_IRQn;
+}
+
+typedef struct {
+    uint32_t received;
+    uint32_t expected;      /* 다음에 와야 할 순번 */
+    uint32_t lost;          /* 빈 순번 합계 */
+    uint32_t out_of_order;
+    stats_t latency;        /* ISR 진입 -> 스레드가 꺼낸 시각 */
+} consumer_t;
+
+static void consume(consumer_t *c) {
+    ring_item_t batch[CONSUMER_BATCH];
+    uint32_t n = ring_pop_batch(&stream, batch, CONSUMER_BATCH);
+    uint32_t now = dwt_cycles();
+    
+    for (uint32_t i = 0; i < n; i++) {
+        if (batch[i].seq < c->expected) {
+            c->out_of_order++;
+        } else {
+            c->lost += batch[i].seq - c->expected;
+            c->expected = batch[i].seq + 1;
+        }
+        stats_add(&c->latency, now - batch[i].stamp);
+    }
+    c->received += n;
+}
+
+static consumer_t stream_result;
+
+static void stream_demo(void) {
+    consumer_t *c = &stream_result;
+    
+    ring_init(&stream, ring_storage, RING_CAPACITY);
+    producer_seq = 0;
+    producer_on = 1;
+    timer0_start();
+    
+    while (c->received < STREAM_SAMPLES) {
+        if (ring_count(&stream) == 0) {
+            /* 비어 있으면 다음 IRQ 까지 대기 (검사 직후 IRQ 가 오면 한 주기 더 잘 뿐 유실은 없음) */
+            __asm volatile ("wfi");
+            continue;
+        }
+        consume(c);
+    }
+    producer_on = 0;
+}
+
+// ========== 3. 오버런: 소비자가 멈추면 ==========
+
+static consumer_t overrun_result;
+static uint32_t overrun_drops;
+
+static void overrun_demo(void) {
+    consumer_t *c = &overrun_result;
+    uint32_t stall_irqs = RING_CAPACITY / SAMPLES_PER_IRQ + 8;
+    
+    ring_init(&stream, ring_storage, RING_CAPACITY);
+    producer_seq = 0;
+    producer_on = 1;
+    
+    /* 링이 가득 찬 뒤에도 8번 더 IRQ 가 올 때까지 꺼내지 않음 */
+    uint32_t start = irq_count;
+    while (irq_count - start < stall_irqs) {
+        __asm volatile ("wfi");
+    }
+    producer_on = 0;
+    
+    asm volatile ("nop"); // Breakpoint 1: 가득 찬 링 (stream.head - stream.tail == mask + 1, stream.drops)
+    while (ring_count(&stream)) {
+        consume(c);
+    }
+    overrun_drops = ring_take_drops(&stream);
+    /* 마지막 IRQ 까지 버려졌다면 끝의 빈 순번은 다음 수신이 없어 lost 에 안 잡힘 */
+    c->lost += producer_seq - c->expected;
+}
+
+// ========== 4. 처리량: 단일 vs 배치 vs 제로 카피 ==========
+
+static ring_item_t bench_src[BENCH_CHUNK];
+static ring_item_t bench_dst[BENCH_CHUNK];
+
+typedef uint32_t (*bench_fn)(uint32_t chunk);
+
+/* 각 방식: chunk 개 넣고 chunk 개 꺼냄, 꺼낸 순번 합 반환 */
+static uint32_t bench_single(uint32_t chunk) {
+    ring_item_t item;
+    uint32_t sum = 0;
+    
+    for (uint32_t i = 0; i < chunk; i++) {
+        ring_push(&stream, &bench_src[i]);
+    }
+    for (uint32_t i = 0; i < chunk; i++) {
+        ring_pop(&stream, &item);
+        sum += item.seq;
+    }
+    return sum;
+}
+
+static uint32_t bench_batch(uint32_t chunk) {
+    uint32_t sum = 0;
+    
+    ring_push_batch(&stream, bench_src, chunk);
+    ring_pop_batch(&stream, bench_dst, chunk);
+    for (uint32_t i = 0; i < chunk; i++) {
+        sum += bench_dst[i].seq;
+    }
+    return sum;
+}
+
+static uint32_t bench_zero_copy(uint32_t chunk) {
+    ring_item_t *slot;
+    uint32_t sum = 0, left, n;
+    
+    for (left = chunk; left; left -= n) {
+        n = ring_reserve(&stream, &slot);
+        if (n > left) n = left;
+        for (uint32_t i = 0; i < n; i++) {
+            slot[i] = bench_src[chunk - left + i];
+        }
+        ring_commit(&stream, n);
+    }
+    for (left = chunk; left; left -= n) {
+        n = ring_peek(&stream, &slot);
+        if (n > left) n = left;
+        for (uint32_t i = 0; i < n; i++) {
+            sum += slot[i].seq;
+        }
+        ring_release(&stream, n);
+    }
+    return sum;
+}
+
+static void bench_row(const char *name, bench_fn fn, uint32_t chunk, uint32_t *base, int *ok) {
+    uint32_t expected = 0, sum = 0;
+    
+    for (uint32_t i = 0; i < chunk; i++) {
+        expected += bench_src[i].seq;
+    }
+    ring_init(&stream, ring_storage, RING_CAPACITY);
+    /* 시작 위치를 어긋나게 해서 chunk 가 랩어라운드에 걸치게 함 */
+    stream.head = stream.tail = 0xFFFFFFF0u;
+    
+    uint32_t start = dwt_cycles();
+    for (uint32_t done = 0; done < BENCH_ITEMS; done += chunk) {
+        sum += fn(chunk);
+    }
+    uint32_t cycles = dwt_elapsed(start);
+    
+    *ok &= sum == expected * (BENCH_ITEMS / chunk) && ring_count(&stream) == 0;
+    if (*base == 0) {
+        *base = cycles;
+    }
+    
+    uint32_t per_item = cycles * 100u / BENCH_ITEMS;
+    uint32_t ratio = cycles ? *base * 100u / cycles : 0;
+    print_string(name);
+    print_number(chunk, 6);
+    print_number(cycles, 10);
+    print_number(per_item / 100, 7);
+    print_string(".");
+    print_number((per_item % 100) / 10, 1);
+    print_number(per_item % 10, 1);
+    print_number(ratio / 100, 5);
+    print_string(".");
+    print_number((ratio % 100) / 10, 1);
+    print_number(ratio % 10, 1);
+    print_string("x\n");
+}
+
+static int benchmark_throughput(void) {
+    uint32_t base = 0;
+    int ok = 1;
+    
+    for (uint32_t i = 0; i < BENCH_CHUNK; i++) {
+        bench_src[i].seq = i * 7 + 1;
+        bench_src[i].stamp = i;
+    }
+    
+    print_string("\nthroughput (1024 items)  chunk    cycles  cyc/item  speedup\n");
+    print_string("-----------------------------------------------------------\n");
+    bench_row("ring_push/ring_pop      ", bench_single, BENCH_CHUNK, &base, &ok);
+    bench_row("push_batch/pop_batch    ", bench_batch, 4, &base, &ok);
+    bench_row("push_batch/pop_batch    ", bench_batch, BENCH_CHUNK, &base, &ok);
+    bench_row("reserve/commit+peek     ", bench_zero_copy, 4, &base, &ok);
+    bench_row("reserve/commit+peek     ", bench_zero_copy, BENCH_CHUNK, &base, &ok);
+    return ok;
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 SPSC 링 버퍼 (Timer0 ISR -> 스레드) ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    
+    print_string("\n[1] FIFO 순서 (단일/배치/제로 카피 혼합, 랩어라운드)\n");
+    int fifo_ok = verify_fifo();
+    
+    print_string("[2] Timer0 10kHz x 4 샘플 -> 스레드 소비 (");
+    print_number(STREAM_SAMPLES, 0);
+    print_string(" 샘플)\n");
+    stream_demo();
+    
+    print_string("[3] 오버런 (소비자 정지)\n");
+    overrun_demo();
+    timer0_stop();
+    
+    asm volatile ("nop"); // Breakpoint 2: 스트리밍 종료 (stream_result, overrun_result)
+    print_string("\nlatency (cycles)              min     avg     max  samples\n");
+    print_string("----------------------------------------------------------\n");
+    print_stats("ISR producer (4 samples) ", 0, &isr_stats);
+    print_stats("ISR -> thread pop        ", 0, &stream_result.latency);
+    
+    print_string("\n  stream : received ");
+    print_number(stream_result.received, 0);
+    print_string(", lost ");
+    print_number(stream_result.lost, 0);
+    print_string(", out of order ");
+    print_number(stream_result.out_of_order, 0);
+    print_string("\n  overrun: received ");
+    print_number(overrun_result.received, 0);
+    print_string(", lost ");
+    print_number(overrun_result.lost, 0);
+    print_string(", drops counted ");
+    print_number(overrun_drops, 0);
+    print_string("\n");
+    
+    int bench_ok = benchmark_throughput();
+    
+    print_string("\n결과 검증:\n");
+    check("FIFO 순서 / 가득 찬 링 거부", fifo_ok);
+    check("스트리밍: 유실 0, 순서 유지", stream_result.received >= STREAM_SAMPLES &&
+          stream_result.lost == 0 && stream_result.out_of_order == 0);
+    check("오버런: 받은 수 == 용량, 빈 순번 == drops",
+          overrun_result.received == RING_CAPACITY && overrun_drops > 0 &&
+          overrun_result.lost == overrun_drops && overrun_result.out_of_order == 0);
+    check("처리량 벤치마크 합계 일치", bench_ok);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
@@ -0,0 +1,139 @@
+/*
+ * SPSC 링 버퍼 구현
+ *
+ * 메모리 순서:
+ *   생산자: 슬롯 쓰기 -> DMB -> head 저장      (소비자가 head 를 보면 데이터도 보임)
+ *   소비자: head 읽기 -> DMB -> 슬롯 읽기 -> DMB -> tail 저장
+ *                                              (생산자가 tail 을 보면 읽기가 끝난 슬롯)
+ * 단일 코어 M33 에서는 DMB 가 거의 공짜지만, 캐시/DMA 가 있는 시스템과 같은 규칙을 씁니다.
+ */
+
+#include "ring.h"
+
+void ring_init(ring_t *r, ring_item_t *buf, uint32_t capacity) {
+    r->head = 0;
+    r->tail = 0;
+    r->drops = 0;
+    r->mask = capacity - 1;
+    r->buf = buf;
+}
+
+// ========== 한 항목 ==========
+
+int ring_push(ring_t *r, const ring_item_t *item) {
+    uint32_t head = r->head;
+    
+    if (head - r->tail > r->mask) {
+        return 0;
+    }
+    RING_DMB();     /* tail 을 읽은 뒤에 슬롯을 덮어씀 */
+    r->buf[head & r->mask] = *item;
+    RING_DMB();
+    r->head = head + 1;
+    return 1;
+}
+
+int ring_pop(ring_t *r, ring_item_t *item) {
+    uint32_t tail = r->tail;
+    
+    if (r->head == tail) {
+        return 0;
+    }
+    RING_DMB();
+    *item = r->buf[tail & r->mask];
+    RING_DMB();
+    r->tail = tail + 1;
+    return 1;
+}
+
+// ========== 배치 ==========
+
+uint32_t ring_push_batch(ring_t *r, const ring_item_t *src, uint32_t n) {
+    uint32_t head = r->head;
+    uint32_t space = r->mask + 1 - (head - r->tail);
+    
+    if (n > space) {
+        n = space;
+    }
+    RING_DMB();
+    for (uint32_t i = 0; i < n; i++) {
+        r->buf[(head + i) & r->mask] = src[i];
+    }
+    RING_DMB();
+    r->head = head + n;
+    return n;
+}
+
+uint32_t ring_pop_batch(ring_t *r, ring_item_t *dst, uint32_t n) {
+    uint32_t tail = r->tail;
+    uint32_t avail = r->head - tail;
+    
+    if (n > avail) {
+        n = avail;
+    }
+    RING_DMB();
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = r->buf[(tail + i) & r->mask];
+    }
+    RING_DMB();
+    r->tail = tail + n;
+    return n;
+}
+
+// ========== 제로 카피 ==========
+
+uint32_t ring_reserve(ring_t *r, ring_item_t **slot) {
+    uint32_t head = r->head;
+    uint32_t index = head & r->mask;
+    uint32_t space = r->mask + 1 - (head - r->tail);
+    uint32_t contiguous = r->mask + 1 - index;
+    
+    RING_DMB();
+    *slot = &r->buf[index];
+    return space < contiguous ? space : contiguous;
+}
+
+void ring_commit(ring_t *r, uint32_t n) {
+    RING_DMB();
+    r->head += n;
+}
+
+uint32_t ring_peek(ring_t *r, ring_item_t **slot) {
+    uint32_t tail = r->tail;
+    uint32_t index = tail & r->mask;
+    uint32_t avail = r->head - tail;
+    uint32_t contiguous = r->mask + 1 - index;
+    
+    RING_DMB();
+    *slot = &r->buf[index];
+    return avail < contiguous ? avail : contiguous;
+}
+
+void ring_release(ring_t *r, uint32_t n) {
+    RING_DMB();
+    r->tail += n;
+}
+
+// ========== 오버런 계수 (LDREX/STREX) ==========
+
+void ring_note_drop(ring_t *r) {
+    uint32_t value, failed;
+    
+    do {
+        __asm volatile ("ldrex %0, [%1]" : "=r"(value) : "r"(&r->drops) : "memory");
+        value++;
+        __asm volatile ("strex %0, %2, [%1]" : "=&r"(failed) : "r"(&r->drops), "r"(value) : "memory");
+    } while (failed);
+}
+
+uint32_t ring_take_drops(ring_t *r) {
+    uint32_t value, failed;
+    
+    /* 읽기와 0 쓰기 사이에 ISR 이 증가시키면 STREX 가 실패 -> 다시 시도 (증가분 유실 없음) */
+    do {
+        __asm volatile ("ldrex %0, [%1]" : "=r"(value) : "r"(&r->drops) : "memory");
+        __asm volatile ("strex %0, %2, [%1]" : "=&r"(failed) : "r"(&r->drops), "r"(0u) : "memory");
+    } while (failed);
+    RING_DMB();
+    return value;
+}
@@ -0,0 +1,67 @@
+/*
+ * 단일 생산자 / 단일 소비자 (SPSC) 링 버퍼 - 락 없음
+ *
+ *   head : 생산자(ISR)만 씀, 소비자는 읽기만
+ *   tail : 소비자(스레드)만 씀, 생산자는 읽기만
+ *
+ * 인덱스는 계속 증가하는 32비트 값이고 슬롯 = 인덱스 & mask (용량은 2의 거듭제곱).
+ * 개수 = head - tail (랩어라운드해도 부호 없는 뺄셈으로 정확).
+ *
+ * 각 인덱스는 쓰는 쪽이 하나뿐이므로 일반 STR + DMB 로 공개합니다.
+ * 양쪽이 모두 쓰는 값(drops: 생산자가 증가, 소비자가 읽고 0으로)은 LDREX/STREX 로 갱신합니다.
+ */
+
+#ifndef RING_H
+#define RING_H
+
+#include <stdint.h>
+
+/* 타이머 ISR 이 넣는 샘플: 순번 + 생성 시각 (dwt_cycles) */
+typedef struct {
+    uint32_t seq;
+    uint32_t stamp;
+} ring_item_t;
+
+typedef struct {
+    volatile uint32_t head;     /* 다음에 쓸 인덱스 (생산자) */
+    volatile uint32_t tail;     /* 다음에 읽을 인덱스 (소비자) */
+    volatile uint32_t drops;    /* 가득 차서 버린 항목 수 (LDREX/STREX) */
+    uint32_t mask;
+    ring_item_t *buf;
+} ring_t;
+
+#define RING_DMB()  __asm volatile ("dmb" : : : "memory")
+
+/* capacity 는 2의 거듭제곱 */
+void ring_init(ring_t *r, ring_item_t *buf, uint32_t capacity);
+
+static inline uint32_t ring_count(const ring_t *r) {
+    return r->head - r->tail;
+}
+
+static inline uint32_t ring_free(const ring_t *r) {
+    return r->mask + 1 - (r->head - r->tail);
+}
+
+/* 한 항목 (가득/비어 있으면 0) */
+int ring_push(ring_t *r, const ring_item_t *item);
+int ring_pop(ring_t *r, ring_item_t *item);
+
+/* 여러 항목 - 실제로 옮긴 개수 반환, 인덱스 공개는 한 번 */
+uint32_t ring_push_batch(ring_t *r, const ring_item_t *src, uint32_t n);
+uint32_t ring_pop_batch(ring_t *r, ring_item_t *dst, uint32_t n);
+
+/*
+ * 제로 카피: 버퍼 안을 직접 쓰고/읽은 뒤 commit/release 로 공개
+ * 반환값 = 랩어라운드 전까지 연속으로 쓸/읽을 수 있는 항목 수
+ */
+uint32_t ring_reserve(ring_t *r, ring_item_t **slot);
+void ring_commit(ring_t *r, uint32_t n);
+uint32_t ring_peek(ring_t *r, ring_item_t **slot);
+void ring_release(ring_t *r, uint32_t n);
+
+/* 오버런 계수 (생산자) / 읽고 0으로 (소비자) */
+void ring_note_drop(ring_t *r);
+uint32_t ring_take_drops(ring_t *r);
+
+#endif /* RING_H */
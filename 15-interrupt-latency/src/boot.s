@@ -0,0 +1,90 @@
+/*
+ * Cortex-M33 Interrupt Latency
+ * 표준 스타트업: .data 복사, .bss 초기화 후 main 진입
+ */
+
+    .syntax unified
+    .thumb
+
+    .section .isr_vector
+    .long   __StackTop           /* MSP initial value */
+    .long   Reset_Handler        /* Reset Handler */
+    .long   Default_Handler      /* NMI */
+    .long   HardFault_Handler    /* HardFault */
+    .long   Default_Handler      /* MemManage */
+    .long   Default_Handler      /* BusFault */
+    .long   Default_Handler      /* UsageFault */
+    .long   Default_Handler      /* SecureFault */
+    .long   0
+    .long   0
+    .long   0
+    .long   Default_Handler      /* SVCall */
+    .long   Default_Handler      /* DebugMonitor */
+    .long   0
+    .long   Default_Handler      /* PendSV */
+    .long   SysTick_Handler      /* SysTick: 주기 지연 측정 (main.c) */
+    .long   Default_Handler      /* IRQ 0: Non-secure watchdog reset */
+    .long   Default_Handler      /* IRQ 1: Non-secure watchdog */
+    .long   Default_Handler      /* IRQ 2: S32K timer */
+    .long   TIMER0_Handler       /* IRQ 3: CMSDK Timer0 */
+    .long   Default_Handler      /* IRQ 4: CMSDK Timer1 */
+    .long   Default_Handler      /* IRQ 5: Dual timer (dwt.c 가 인터럽트 없이 사용) */
+    .long   IRQ6_Handler         /* IRQ 6: 소프트웨어 pend 전용 A */
+    .long   IRQ7_Handler         /* IRQ 7: 소프트웨어 pend 전용 B */
+    .long   IRQ8_Handler         /* IRQ 8: 예외 프레임 크기 측정 (probe.s) */
+    .long   IRQ9_Handler         /* IRQ 9: 큰 스택 프레임 핸들러 */
+
+    .text
+    .thumb_func
+    .global Reset_Handler
+Reset_Handler:
+    /* 스택 포인터 설정 */
+    ldr r0, =__StackTop
+    mov sp, r0
+
+    /* FPU 접근 허용: CPACR.CP10/CP11 = 11 (main 이전 - 컴파일러가 FP 레지스터를 쓸 수 있음) */
+    ldr     r0, =0xE000ED88
+    ldr     r1, [r0]
+    orr     r1, r1, #(0xF << 20)
+    str     r1, [r0]
+    dsb
+    isb
+
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
+
+    /* main 함수 호출 */
+    bl main
+    
+hang:
+    b hang
+
+    .thumb_func
+    .weak HardFault_Handler
+HardFault_Handler:
+    .thumb_func
+    .global Default_Handler
+Default_Handler:
+    b Default_Handler
@@ -0,0 +1,508 @@
+/*
+ * Cortex-M33 인터럽트 지연 측정 실습 예제
+ * 진입 지연, tail-chaining, late arrival, 우선순위/BASEPRI, lazy FP stacking, 큰 스택 프레임
+ */
+
+#include <stdint.h>
+#include "nvic.h"
+#include "report.h"
+#include "dwt.h"
+
+#define SAMPLES         32
+#define TIMER_PERIOD    1000    /* Timer0 / SysTick 주기 (25MHz 클럭) */
+#define WORK_LOOPS      100     /* 핸들러/스레드가 붙잡고 있는 구간 */
+#define LATE_RELOAD     0xFFFF
+
+#define PRIO_TIMER      0x00
+#define PRIO_A          0x40
+#define PRIO_LOW        0x80
+
+// ========== 측정 통계 ==========
+
+#define NAME_WIDTH 32
+
+static void print_header(const char *title) {
+    print_string("\n");
+    print_padded(title, NAME_WIDTH);
+    print_string("     min     avg     max  samples\n");
+    print_string("-----------------------------------------------------------------\n");
+}
+
+/* 두 스탬프 사이 (dwt_cycles 읽기 오버헤드 보정) */
+static uint32_t span(uint32_t from, uint32_t to) {
+    uint32_t delta = to - from;
+    return delta > dwt_overhead ? delta - dwt_overhead : 0;
+}
+
+/* a 가 b 보다 먼저 (32비트 랩어라운드 고려) */
+static int before(uint32_t a, uint32_t b) {
+    return (int32_t)(b - a) > 0;
+}
+
+static void busy(int loops) {
+    for (volatile int i = 0; i < loops; i++) {
+    }
+}
+
+// ========== 핸들러 ==========
+
+typedef void (*irq_action_t)(void);
+
+/* 소프트웨어 pend 핸들러가 남기는 기록 */
+typedef struct {
+    volatile uint32_t entry;        /* 핸들러 본문 첫 스탬프 */
+    volatile uint32_t exit;         /* 반환 직전 스탬프 */
+    volatile uint32_t count;
+    irq_action_t volatile action;   /* 측정마다 바꾸는 본문 */
+} irq_probe_t;
+
+static irq_probe_t irq_a, irq_b;
+
+void IRQ6_Handler(void) {
+    irq_a.entry = dwt_cycles();
+    if (irq_a.action) {
+        irq_a.action();
+    }
+    irq_a.count++;
+    irq_a.exit = dwt_cycles();
+}
+
+void IRQ7_Handler(void) {
+    irq_b.entry = dwt_cycles();
+    if (irq_b.action) {
+        irq_b.action();
+    }
+    irq_b.count++;
+    irq_b.exit = dwt_cycles();
+}
+
+/* 512바이트 지역 배열 -> 프롤로그가 callee-saved push + sub sp 후에야 본문 시작 */
+static volatile uint32_t heavy_entry;
+static volatile uint32_t heavy_sink;
+
+void IRQ9_Handler(void) {
+    volatile uint32_t scratch[128];
+    
+    heavy_entry = dwt_cycles();
+    for (int i = 0; i < 128; i++) {
+        scratch[i] = i ^ heavy_entry;
+    }
+    heavy_sink = scratch[heavy_entry & 127];
+}
+
+/* probe.s 의 IRQ8_Handler 가 기록 */
+extern volatile uint32_t probe_msp;
+extern volatile uint32_t probe_exc_return;
+
+/* Timer0: 감소 카운터이므로 RELOAD - VALUE = 만료 후 지난 클럭 */
+static volatile int timer0_oneshot;
+static volatile uint32_t timer0_entry;
+static volatile uint32_t timer0_latency;
+static volatile uint32_t timer0_count;
+static stats_t timer0_stats;
+
+void TIMER0_Handler(void) {
+    uint32_t value = TIMER0_VALUE;
+    uint32_t now = dwt_cycles();
+    
+    TIMER0_INTCLEAR = 1;
+    timer0_latency = TIMER0_RELOAD - value;
+    timer0_entry = now;
+    timer0_count++;
+    if (timer0_oneshot) {
+        TIMER0_CTRL = 0;
+        return;
+    }
+    stats_add(&timer0_stats, timer0_latency);
+    if (timer0_stats.count >= SAMPLES) {
+        TIMER0_CTRL = 0;
+    }
+}
+
+static stats_t systick_stats;
+
+void SysTick_Handler(void) {
+    uint32_t value = SYST_CVR;
+    
+    stats_add(&systick_stats, SYST_RVR - value);
+    if (systick_stats.count >= SAMPLES) {
+        SYST_CSR = 0;
+    }
+}
+
+// ========== 1. 진입 지연: pend -> 핸들러 본문 ==========
+
+static void measure_pend(stats_t *s, uint32_t irq, volatile uint32_t *entry) {
+    for (int i = 0; i < SAMPLES; i++) {
+        uint32_t start = dwt_cycles();
+        nvic_pend(1u << irq);
+        stats_add(s, span(start, *entry));
+    }
+}
+
+static stats_t pend_leaf, pend_heavy, pend_fp_lazy, pend_fp_full;
+
+static void measure_entry(void) {
+    irq_a.action = 0;
+    measure_pend(&pend_leaf, IRQ_A, &irq_a.entry);
+    measure_pend(&pend_heavy, IRQ_HEAVY, &heavy_entry);
+    
+    /* 스레드가 FP 문맥을 가진 상태: lazy 면 공간만 예약, 아니면 s0-s15/FPSCR 즉시 저장 */
+    FPU_FPCCR |= FPCCR_LSPEN;
+    fp_context_open();
+    measure_pend(&pend_fp_lazy, IRQ_A, &irq_a.entry);
+    FPU_FPCCR &= ~FPCCR_LSPEN;
+    measure_pend(&pend_fp_full, IRQ_A, &irq_a.entry);
+    FPU_FPCCR |= FPCCR_LSPEN;
+    fp_context_close();
+}
+
+// ========== 2. 하드웨어 타이머 지연 ==========
+
+static void measure_timers(void) {
+    timer0_oneshot = 0;
+    TIMER0_CTRL = 0;
+    TIMER0_RELOAD = TIMER_PERIOD - 1;
+    TIMER0_VALUE = TIMER_PERIOD - 1;
+    TIMER0_INTCLEAR = 1;
+    TIMER0_CTRL = TIMER_CTRL_IRQEN | TIMER_CTRL_EN;
+    while (timer0_stats.count < SAMPLES) {
+        __asm volatile ("wfi");
+    }
+    
+    SYST_RVR = TIMER_PERIOD - 1;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_CLKSOURCE | SYST_CSR_TICKINT | SYST_CSR_ENABLE;
+    while (systick_stats.count < SAMPLES) {
+        __asm volatile ("wfi");
+    }
+}
+
+// ========== 3. 핸들러 안의 첫 FP 명령 (lazy 저장 시점) ==========
+
+static volatile uint32_t fp_op_cycles;
+
+static void fp_op_action(void) {
+    uint32_t start = dwt_cycles();
+    
+    /* 스레드 FP 문맥이 있고 lazy 면 이 명령에서 s0-s15/FPSCR 가 예약 공간에 저장됨 */
+    __asm volatile ("vmov s1, %0\n\tvadd.f32 s2, s1, s1" : : "r"(start) : "s1", "s2");
+    fp_op_cycles = span(start, dwt_cycles());
+}
+
+static stats_t fp_op_none, fp_op_lazy, fp_op_full;
+
+static void measure_fp_op(stats_t *s) {
+    for (int i = 0; i < SAMPLES; i++) {
+        nvic_pend(1u << IRQ_A);
+        stats_add(s, fp_op_cycles);
+    }
+}
+
+static void measure_fp(void) {
+    irq_a.action = fp_op_action;
+    fp_context_close();
+    measure_fp_op(&fp_op_none);
+    fp_context_open();
+    measure_fp_op(&fp_op_lazy);
+    FPU_FPCCR &= ~FPCCR_LSPEN;
+    measure_fp_op(&fp_op_full);
+    FPU_FPCCR |= FPCCR_LSPEN;
+    fp_context_close();
+    irq_a.action = 0;
+}
+
+// ========== 4. 예외 프레임 크기 ==========
+
+static uint32_t frame_basic, frame_fp;
+static uint32_t exc_return_basic, exc_return_fp;
+
+static void measure_frames(void) {
+    uint32_t msp;
+    
+    fp_context_close();
+    msp = get_msp();
+    nvic_pend(1u << IRQ_PROBE);
+    frame_basic = msp - probe_msp;
+    exc_return_basic = probe_exc_return;
+    
+    fp_context_open();
+    msp = get_msp();
+    nvic_pend(1u << IRQ_PROBE);
+    frame_fp = msp - probe_msp;
+    exc_return_fp = probe_exc_return;
+    fp_context_close();
+}
+
+// ========== 5. tail-chaining ==========
+
+static stats_t chain_tail, chain_thread;
+static int chain_order_ok = 1;
+
+static void measure_tail_chain(void) {
+    nvic_set_priority(IRQ_A, PRIO_A);
+    nvic_set_priority(IRQ_B, PRIO_A);
+    irq_a.action = 0;
+    irq_b.action = 0;
+    
+    for (int i = 0; i < SAMPLES; i++) {
+        /* 같은 우선순위 둘을 동시에 pend: 번호가 작은 A 먼저, B 는 스레드로 돌아가지 않고 바로 */
+        nvic_pend((1u << IRQ_A) | (1u << IRQ_B));
+        chain_order_ok &= before(irq_a.exit, irq_b.entry);
+        stats_add(&chain_tail, span(irq_a.exit, irq_b.entry));
+    
+        /* 비교: A 가 스레드로 돌아온 뒤 B 를 pend (예외 복귀 + 재진입) */
+        nvic_pend(1u << IRQ_A);
+        nvic_pend(1u << IRQ_B);
+        stats_add(&chain_thread, span(irq_a.exit, irq_b.entry));
+    }
+}
+
+// ========== 6. 우선순위 구성 ==========
+
+static volatile uint32_t pend_stamp;
+
+static void pend_a_then_work(void) {
+    pend_stamp = dwt_cycles();
+    nvic_pend(1u << IRQ_A);
+    busy(WORK_LOOPS);
+}
+
+typedef struct {
+    const char *name;
+    uint8_t priority_b;         /* A 를 pend 하는 핸들러 B 의 우선순위 (A = PRIO_A) */
+    int expect_preempt;
+    stats_t latency;
+    int order_ok;
+} prio_case_t;
+
+static prio_case_t prio_cases[] = {
+    { .name = "A 0x40 pended in B 0x60", .priority_b = 0x60, .expect_preempt = 1 },
+    { .name = "A 0x40 pended in B 0x40", .priority_b = 0x40, .expect_preempt = 0 },
+    { .name = "A 0x40 pended in B 0x20", .priority_b = 0x20, .expect_preempt = 0 },
+};
+#define PRIO_CASES (sizeof(prio_cases) / sizeof(prio_cases[0]))
+
+static stats_t basepri_latency;
+static int basepri_ok = 1;
+
+static void measure_priorities(void) {
+    nvic_set_priority(IRQ_A, PRIO_A);
+    irq_a.action = 0;
+    irq_b.action = pend_a_then_work;
+    
+    for (unsigned c = 0; c < PRIO_CASES; c++) {
+        prio_case_t *pc = &prio_cases[c];
+        pc->order_ok = 1;
+        nvic_set_priority(IRQ_B, pc->priority_b);
+        for (int i = 0; i < SAMPLES; i++) {
+            nvic_pend(1u << IRQ_B);
+            /* 선점이면 A 가 B 의 본문 도중에, 아니면 B 가 끝난 뒤에 실행 */
+            int preempted = before(irq_a.entry, irq_b.exit);
+            pc->order_ok &= preempted == pc->expect_preempt;
+            stats_add(&pc->latency, span(pend_stamp, irq_a.entry));
+        }
+    }
+    irq_b.action = 0;
+    
+    /* 스레드가 BASEPRI 로 A 를 가린 채 일하다 해제 */
+    for (int i = 0; i < SAMPLES; i++) {
+        uint32_t count = irq_a.count;
+        set_basepri(PRIO_A);
+        uint32_t start = dwt_cycles();
+        nvic_pend(1u << IRQ_A);
+        busy(WORK_LOOPS);
+        basepri_ok &= irq_a.count == count;
+        set_basepri(0);
+        basepri_ok &= irq_a.count == count + 1;
+        stats_add(&basepri_latency, span(start, irq_a.entry));
+    }
+}
+
+// ========== 7. late arrival: 낮은 우선순위 진입 중에 높은 우선순위 도착 ==========
+
+static const uint16_t late_delays[] = { 1, 2, 4, 8, 12, 16, 24, 32, 48, 64 };
+#define LATE_CASES (sizeof(late_delays) / sizeof(late_delays[0]))
+
+typedef struct {
+    uint32_t b_latency;         /* pend -> B 본문 */
+    uint32_t timer_latency;     /* Timer0 만료 -> 핸들러 (RELOAD - VALUE) */
+    int order;                  /* 0: Timer0 먼저, 1: B 를 선점, 2: B 이후 */
+} late_result_t;
+
+static late_result_t late_results[LATE_CASES];
+static int late_ok = 1;
+
+static void busy_action(void) {
+    busy(WORK_LOOPS);
+}
+
+static void measure_late_arrival(void) {
+    nvic_set_priority(TIMER0_IRQn, PRIO_TIMER);
+    nvic_set_priority(IRQ_B, PRIO_LOW);
+    irq_b.action = busy_action;
+    timer0_oneshot = 1;
+    
+    for (unsigned d = 0; d < LATE_CASES; d++) {
+        uint32_t timer_count = timer0_count;
+        uint32_t b_count = irq_b.count;
+    
+        TIMER0_CTRL = 0;
+        TIMER0_INTCLEAR = 1;
+        TIMER0_RELOAD = LATE_RELOAD;
+        TIMER0_VALUE = late_delays[d];
+    
+        uint32_t start = dwt_cycles();
+        TIMER0_CTRL = TIMER_CTRL_IRQEN | TIMER_CTRL_EN;
+        nvic_pend(1u << IRQ_B);
+        while (timer0_count == timer_count) {
+        }
+    
+        late_result_t *r = &late_results[d];
+        r->b_latency = span(start, irq_b.entry);
+        r->timer_latency = timer0_latency;
+        if (before(timer0_entry, irq_b.entry)) {
+            r->order = 0;
+        } else if (before(timer0_entry, irq_b.exit)) {
+            r->order = 1;
+        } else {
+            r->order = 2;
+        }
+        late_ok &= irq_b.count == b_count + 1;
+    }
+    irq_b.action = 0;
+    timer0_oneshot = 0;
+}
+
+// ========== 출력 ==========
+
+static void print_frame(const char *name, uint32_t bytes, uint32_t exc_return) {
+    print_padded(name, NAME_WIDTH);
+    print_number(bytes, 8);
+    print_string("   ");
+    /* EXC_RETURN 하위 바이트: 0xFD/0xED 등 - bit 4 = 0 이면 FP 확장 프레임 */
+    print_string(exc_return & (1u << 4) ? "basic (bit4=1)" : "extended FP (bit4=0)");
+    print_string("\n");
+}
+
+static const char *const late_order_names[] = { "Timer0 first", "preempts B", "after B" };
+
+static void print_late(void) {
+    print_string("\nlate arrival (B 0x80 pended, Timer0 0x00 expires after d clocks)\n");
+    print_string("      d  pend->B  Timer0 latency  order\n");
+    print_string("-----------------------------------------------\n");
+    for (unsigned d = 0; d < LATE_CASES; d++) {
+        print_number(late_delays[d], 7);
+        print_number(late_results[d].b_latency, 9);
+        print_number(late_results[d].timer_latency, 16);
+        print_string("  ");
+        print_string(late_order_names[late_results[d].order]);
+        print_string("\n");
+    }
+}
+
+static unsigned priority_bits(void) {
+    unsigned bits = 0;
+    
+    NVIC_IPR[IRQ_PROBE] = 0xFF;
+    for (uint8_t v = NVIC_IPR[IRQ_PROBE]; v; v <<= 1) {
+        bits++;
+    }
+    NVIC_IPR[IRQ_PROBE] = 0;
+    return bits;
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 인터럽트 지연 (NVIC, SysTick, CMSDK Timer0) ===\n");
+    
+    dwt_init();
+    print_string("사이클 소스: ");
+    print_string(dwt_use_timer ? "Dual Timer 1 (DWT 미구현 - QEMU)\n" : "DWT CYCCNT\n");
+    print_string("NVIC 우선순위 비트: ");
+    print_number(priority_bits(), 0);
+    print_string("\n");
+    
+    nvic_set_priority(IRQ_A, PRIO_A);
+    nvic_set_priority(IRQ_B, PRIO_A);
+    nvic_set_priority(IRQ_PROBE, PRIO_A);
+    nvic_set_priority(IRQ_HEAVY, PRIO_A);
+    nvic_set_priority(TIMER0_IRQn, PRIO_TIMER);
+    nvic_enable(IRQ_A);
+    nvic_enable(IRQ_B);
+    nvic_enable(IRQ_PROBE);
+    nvic_enable(IRQ_HEAVY);
+    nvic_enable(TIMER0_IRQn);
+    
+    print_string("\n[1] pend -> 핸들러 진입 (leaf / 512B 프레임 / FP 문맥)\n");
+    measure_entry();
+    print_string("[2] Timer0 / SysTick 만료 -> 핸들러\n");
+    measure_timers();
+    print_string("[3] 핸들러 첫 FP 명령 (lazy stacking)\n");
+    measure_fp();
+    print_string("[4] 예외 프레임 크기\n");
+    measure_frames();
+    print_string("[5] tail-chaining\n");
+    measure_tail_chain();
+    print_string("[6] 우선순위 / BASEPRI\n");
+    measure_priorities();
+    print_string("[7] late arrival\n");
+    measure_late_arrival();
+    
+    asm volatile ("nop"); // Breakpoint 1: 측정 종료 (pend_leaf, chain_tail, late_results)
+    print_header("entry latency (cycles)");
+    print_stats("pend -> handler (leaf)", NAME_WIDTH, &pend_leaf);
+    print_stats("pend -> handler (512B frame)", NAME_WIDTH, &pend_heavy);
+    print_stats("pend -> handler (FP ctx, lazy)", NAME_WIDTH, &pend_fp_lazy);
+    print_stats("pend -> handler (FP ctx, full)", NAME_WIDTH, &pend_fp_full);
+    print_stats("Timer0 expiry -> handler", NAME_WIDTH, &timer0_stats);
+    print_stats("SysTick wrap -> handler", NAME_WIDTH, &systick_stats);
+    
+    print_header("first FP op in handler");
+    print_stats("no thread FP ctx", NAME_WIDTH, &fp_op_none);
+    print_stats("thread FP ctx, lazy", NAME_WIDTH, &fp_op_lazy);
+    print_stats("thread FP ctx, full", NAME_WIDTH, &fp_op_full);
+    
+    print_header("A exit -> B entry");
+    print_stats("tail-chain (A|B pended)", NAME_WIDTH, &chain_tail);
+    print_stats("via thread (A, then B)", NAME_WIDTH, &chain_thread);
+    
+    print_header("pend -> A entry (B works 100x)");
+    for (unsigned c = 0; c < PRIO_CASES; c++) {
+        print_stats(prio_cases[c].name, NAME_WIDTH, &prio_cases[c].latency);
+    }
+    print_stats("A 0x40 masked by BASEPRI 0x40", NAME_WIDTH, &basepri_latency);
+    
+    print_string("\n");
+    print_padded("exception frame", NAME_WIDTH);
+    print_string("   bytes   EXC_RETURN\n");
+    print_string("-----------------------------------------------------------------\n");
+    print_frame("thread without FP ctx", frame_basic, exc_return_basic);
+    print_frame("thread with FP ctx", frame_fp, exc_return_fp);
+    
+    print_late();
+    
+    print_string("\n결과 검증:\n");
+    check("샘플 수 (pend / Timer0 / SysTick / FP)",
+          pend_leaf.count == SAMPLES && pend_heavy.count == SAMPLES &&
+          pend_fp_lazy.count == SAMPLES && pend_fp_full.count == SAMPLES &&
+          timer0_stats.count == SAMPLES && systick_stats.count == SAMPLES &&
+          fp_op_lazy.count == SAMPLES);
+    check("tail-chain: A 종료 후 B 진입", chain_order_ok && chain_tail.count == SAMPLES);
+    check("B 0x60 안에서 pend 된 A 0x40 는 선점", prio_cases[0].order_ok);
+    check("같은/높은 우선순위 B 는 끝난 뒤 A 실행", prio_cases[1].order_ok && prio_cases[2].order_ok);
+    check("BASEPRI 0x40 가 A 를 가렸다가 해제 시 실행", basepri_ok);
+    /* 기본 프레임 8워드 (+ 8바이트 정렬 패딩 4), FP 확장 프레임 26워드 (+4) */
+    check("예외 프레임: 기본 32B, FP 확장 104B",
+          (frame_basic == 32 || frame_basic == 36) && (frame_fp == 104 || frame_fp == 108) &&
+          (exc_return_basic & (1u << 4)) && !(exc_return_fp & (1u << 4)));
+    check("late arrival: 모든 경우 두 핸들러 실행", late_ok);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
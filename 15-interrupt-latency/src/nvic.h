@@ -0,0 +1,80 @@
+/*
+ * NVIC / SysTick / FPU / CMSDK 타이머 레지스터 (MPS2-AN505, Secure 별칭)
+ */
+
+#ifndef NVIC_H
+#define NVIC_H
+
+#include <stdint.h>
+
+#define NVIC_ISER0          (*(volatile uint32_t *)0xE000E100)
+#define NVIC_ICER0          (*(volatile uint32_t *)0xE000E180)
+#define NVIC_ISPR0          (*(volatile uint32_t *)0xE000E200)
+#define NVIC_ICPR0          (*(volatile uint32_t *)0xE000E280)
+#define NVIC_IPR            ((volatile uint8_t *)0xE000E400)   /* IRQ 당 1바이트, 상위 비트만 구현 */
+
+#define SCB_SHPR3           (*(volatile uint32_t *)0xE000ED20) /* [31:24] SysTick, [23:16] PendSV */
+
+#define SYST_CSR            (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR            (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR            (*(volatile uint32_t *)0xE000E018)
+#define SYST_CSR_ENABLE     (1u << 0)
+#define SYST_CSR_TICKINT    (1u << 1)
+#define SYST_CSR_CLKSOURCE  (1u << 2)  /* 프로세서 클럭 */
+
+#define FPU_FPCCR           (*(volatile uint32_t *)0xE000EF34)
+#define FPCCR_LSPEN         (1u << 30) /* lazy 저장 */
+#define FPCCR_ASPEN         (1u << 31) /* FP 사용 시 CONTROL.FPCA 자동 설정 */
+
+/* CMSDK Timer0 - 감소 카운터, 0 도달 시 RELOAD 로 다시 적재하며 인터럽트 */
+#define TIMER0_CTRL         (*(volatile uint32_t *)0x50000000)
+#define TIMER0_VALUE        (*(volatile uint32_t *)0x50000004)
+#define TIMER0_RELOAD       (*(volatile uint32_t *)0x50000008)
+#define TIMER0_INTCLEAR     (*(volatile uint32_t *)0x5000000C)
+#define TIMER_CTRL_EN       (1u << 0)
+#define TIMER_CTRL_IRQEN    (1u << 3)
+
+#define TIMER0_IRQn         3
+#define IRQ_A               6       /* 소프트웨어 pend 전용 */
+#define IRQ_B               7
+#define IRQ_PROBE           8
+#define IRQ_HEAVY           9
+
+static inline void nvic_enable(uint32_t irq) {
+    NVIC_ISER0 = 1u << irq;
+}
+
+static inline void nvic_set_priority(uint32_t irq, uint8_t priority) {
+    NVIC_IPR[irq] = priority;
+}
+
+/* pend 후 DSB/ISB: 다음 명령어 전에 예외가 받아들여지도록 */
+static inline void nvic_pend(uint32_t mask) {
+    NVIC_ISPR0 = mask;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+static inline void set_basepri(uint32_t value) {
+    __asm volatile ("msr basepri, %0\n\tisb" : : "r"(value) : "memory");
+}
+
+static inline uint32_t get_msp(void) {
+    uint32_t value;
+    __asm volatile ("mrs %0, msp" : "=r"(value));
+    return value;
+}
+
+/* FP 명령 하나 실행 -> CONTROL.FPCA = 1 (스레드가 FP 문맥을 가짐) */
+static inline void fp_context_open(void) {
+    __asm volatile ("vmov s0, %0" : : "r"(0x3F800000u) : "s0");
+}
+
+/* CONTROL.FPCA = 0 (FP 문맥 없음 -> 예외 진입 시 기본 프레임) */
+static inline void fp_context_close(void) {
+    uint32_t control;
+    __asm volatile ("mrs %0, control" : "=r"(control));
+    control &= ~(1u << 2);
+    __asm volatile ("msr control, %0\n\tisb" : : "r"(control) : "memory");
+}
+
+#endif /* NVIC_H */
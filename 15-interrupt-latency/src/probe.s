@@ -0,0 +1,28 @@
+/*
+ * 예외 프레임 크기 측정용 핸들러
+ * C 핸들러는 프롤로그(push)가 먼저 실행되므로, 진입 직후의 MSP 를 읽으려고 어셈블리로 작성합니다.
+ *   frame_bytes = (pend 직전 스레드 MSP) - probe_msp
+ */
+
+    .syntax unified
+    .thumb
+
+    .text
+    .thumb_func
+    .global IRQ8_Handler
+IRQ8_Handler:
+    mrs     r0, msp
+    ldr     r1, =probe_msp
+    str     r0, [r1]
+    ldr     r1, =probe_exc_return
+    str     lr, [r1]                /* EXC_RETURN bit 4 = 0 이면 FP 확장 프레임 */
+    bx      lr
+
+    .bss
+    .align  2
+    .global probe_msp
+probe_msp:
+    .space  4
+    .global probe_exc_return
+probe_exc_return:
+    .space  4
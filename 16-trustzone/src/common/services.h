@@ -0,0 +1,34 @@
+/*
+ * Secure 이미지가 NSC 베니어로 내보내는 서비스 (두 이미지가 함께 포함)
+ *
+ * secure 빌드(-mcmse)에서는 cmse_nonsecure_entry 로 정의되어 링커가 .gnu.sgstubs 에
+ * "SG; B.W __acle_se_<이름>" 베니어를 만들고, non-secure 빌드는 import 라이브러리의
+ * 베니어 주소로 평범한 BL 을 합니다.
+ */
+
+#ifndef SERVICES_H
+#define SERVICES_H
+
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE & 2)
+#define SECURE_ENTRY __attribute__((cmse_nonsecure_entry))
+#else
+#define SECURE_ENTRY
+#endif
+
+/* 콘솔 출력 (semihosting). 문자열이 NS 메모리가 아니면 -1, 아니면 출력한 글자 수 */
+SECURE_ENTRY int s_print(const char *str);
+
+/* NS 힙 (NS_HEAP 영역, 메타데이터는 secure RAM). 실패 시 0 / -1 */
+SECURE_ENTRY void *s_heap_alloc(uint32_t size);
+SECURE_ENTRY int s_heap_free(void *ptr);
+SECURE_ENTRY uint32_t s_heap_free_bytes(void);
+
+/* 게이트웨이 왕복 비용 측정용 최소 서비스 */
+SECURE_ENTRY uint32_t s_add(uint32_t a, uint32_t b);
+
+/* semihosting 종료 (0 = 성공) - 반환하지 않음 */
+SECURE_ENTRY void s_exit(int code);
+
+#endif /* SERVICES_H */
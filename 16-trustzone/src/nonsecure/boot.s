@@ -0,0 +1,64 @@
+/*
+ * Non-secure 부트 (벡터 테이블 0x00200000)
+ *
+ * secure main 이 VTOR_NS = 이 테이블, MSP_NS = 첫 워드로 설정한 뒤 Reset_Handler 로 BLXNS 합니다.
+ * 따라서 여기부터는 Non-secure 상태이며 secure 메모리는 NSC 베니어로만 들어갈 수 있습니다.
+ */
+
+    .syntax unified
+    .thumb
+
+.section .isr_vector
+    .long    __StackTop         /* Initial Top of Stack (MSP_NS) */
+    .long    Reset_Handler      /* Reset Handler */
+    .long    Default_Handler    /* NMI */
+    .long    Default_Handler    /* HardFault */
+    .long    Default_Handler    /* MemManage */
+    .long    Default_Handler    /* BusFault */
+    .long    Default_Handler    /* UsageFault */
+    .long    0                  /* SecureFault 는 Secure 쪽으로만 */
+    .long    0
+    .long    0
+    .long    0
+    .long    Default_Handler    /* SVCall */
+    .long    Default_Handler    /* DebugMonitor */
+    .long    0
+    .long    Default_Handler    /* PendSV */
+    .long    Default_Handler    /* SysTick */
+
+.text
+.thumb_func
+.global Reset_Handler
+Reset_Handler:
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
+
+    ldr     R0, = main
+    bx      R0
+
+.thumb_func
+.global Default_Handler
+Default_Handler:
+    b       Default_Handler
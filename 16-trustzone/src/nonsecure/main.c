@@ -0,0 +1,258 @@
+/*
+ * Cortex-M33 TrustZone 실습 예제 - Non-secure 애플리케이션
+ * 출력/힙/종료를 secure 서비스(NSC 베니어)로 호출하고, 게이트웨이 왕복 비용을 직접 호출과 비교
+ */
+
+#include <stdint.h>
+#include "services.h"
+
+#define CALLS           1000
+
+/* Non-secure SysTick (NS 에서 0xE000E010 은 NS 뱅크) - 24비트 감소 카운터 */
+#define SYST_CSR        (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR        (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR        (*(volatile uint32_t *)0xE000E018)
+#define SYST_MASK       0x00FFFFFFu
+
+#define SECURE_ADDRESS  0x10000000u     /* secure 이미지 벡터 테이블 */
+
+extern uint32_t __ns_heap_start, __ns_heap_end;
+
+// 출력은 secure 서비스로
+int print_string(const char *str) {
+    return s_print(str);
+}
+
+void print_hex(uint32_t value) {
+    char buffer[11];
+    
+    buffer[0] = '0';
+    buffer[1] = 'x';
+    for (int i = 0; i < 8; i++) {
+        uint32_t digit = (value >> (28 - i * 4)) & 0xF;
+        buffer[2 + i] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    }
+    buffer[10] = '\0';
+    print_string(buffer);
+}
+
+void print_number(unsigned int value, int width) {
+    char buffer[12];
+    int i = 11;
+    
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+        width--;
+    } while (value > 0 && i > 0);
+    while (width-- > 0 && i > 0) {
+        buffer[--i] = ' ';
+    }
+    print_string(&buffer[i]);
+}
+
+/* value / 100 을 소수 둘째 자리까지 */
+static void print_fixed2(uint32_t value, int width) {
+    print_number(value / 100, width - 3);
+    print_string(".");
+    print_number((value % 100) / 10, 0);
+    print_number(value % 10, 0);
+}
+
+static void print_padded(const char *str, int width) {
+    print_string(str);
+    for (const char *p = str; *p; p++) {
+        width--;
+    }
+    while (width-- > 0) {
+        print_string(" ");
+    }
+}
+
+static int failures;
+
+static void check(const char *name, int ok) {
+    print_string(ok ? "  OK        " : "  MISMATCH  ");
+    print_string(name);
+    print_string("\n");
+    if (!ok) failures++;
+}
+
+// ========== 사이클 측정 ==========
+
+static void cycles_init(void) {
+    SYST_RVR = SYST_MASK;
+    SYST_CVR = 0;
+    SYST_CSR = 5;   /* CLKSOURCE=프로세서 클럭, ENABLE */
+}
+
+static inline uint32_t cycles_now(void) {
+    return SYST_CVR;
+}
+
+/* 감소 카운터: from - to (24비트 랩어라운드) */
+static uint32_t cycles_since(uint32_t from) {
+    return (from - cycles_now()) & SYST_MASK;
+}
+
+/* 비교 기준: 같은 이미지 안 직접 호출 */
+__attribute__((noinline)) uint32_t ns_add(uint32_t a, uint32_t b) {
+    return a + b;
+}
+
+static volatile uint32_t sink;
+
+static uint32_t bench_loop(void) {
+    uint32_t sum = 0;
+    uint32_t start = cycles_now();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        sum += i;
+        __asm volatile ("" : "+r"(sum));
+    }
+    uint32_t cycles = cycles_since(start);
+    sink = sum;
+    return cycles;
+}
+
+static uint32_t bench_direct(void) {
+    uint32_t sum = 0;
+    uint32_t start = cycles_now();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        sum = ns_add(sum, i);
+    }
+    uint32_t cycles = cycles_since(start);
+    sink = sum;
+    return cycles;
+}
+
+static uint32_t bench_gateway(void) {
+    uint32_t sum = 0;
+    uint32_t start = cycles_now();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        sum = s_add(sum, i);
+    }
+    uint32_t cycles = cycles_since(start);
+    sink = sum;
+    return cycles;
+}
+
+/* 게이트웨이 2회 + secure 쪽 first-fit 탐색 */
+static uint32_t bench_heap(void) {
+    uint32_t start = cycles_now();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        void *p = s_heap_alloc(64);
+        s_heap_free(p);
+    }
+    return cycles_since(start);
+}
+
+#define NAME_WIDTH 32
+
+static void print_bench(const char *name, uint32_t cycles, uint32_t loop) {
+    uint32_t net = cycles > loop ? cycles - loop : 0;
+    
+    print_padded(name, NAME_WIDTH);
+    print_number(cycles, 9);
+    print_fixed2(net * 100 / CALLS, 10);
+    print_string("\n");
+}
+
+// ========== 서비스 검증 ==========
+
+static int in_heap(void *p, uint32_t size) {
+    uint32_t addr = (uint32_t)p;
+    return addr >= (uint32_t)&__ns_heap_start && addr + size <= (uint32_t)&__ns_heap_end;
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 TrustZone: Non-secure 애플리케이션 ===\n");
+    print_string("(이 출력도 s_print 게이트웨이를 거칩니다)\n");
+    
+    cycles_init();
+    
+    // 1. 힙 서비스
+    uint32_t free_before = s_heap_free_bytes();
+    uint8_t *a = s_heap_alloc(100);
+    uint8_t *b = s_heap_alloc(64);
+    uint32_t free_used = s_heap_free_bytes();
+    
+    print_string("\ns_heap_alloc(100) = ");
+    print_hex((uint32_t)a);
+    print_string("\ns_heap_alloc(64)  = ");
+    print_hex((uint32_t)b);
+    print_string("\nfree bytes: ");
+    print_number(free_before, 0);
+    print_string(" -> ");
+    print_number(free_used, 0);
+    print_string("\n");
+    
+    /* 반환된 블록은 NS 메모리이므로 NS 가 직접 쓰고 읽을 수 있음 */
+    int pattern_ok = a && b;
+    if (pattern_ok) {
+        for (int i = 0; i < 100; i++) a[i] = (uint8_t)i;
+        for (int i = 0; i < 64; i++) b[i] = 0xA5;
+        for (int i = 0; i < 100; i++) pattern_ok &= a[i] == (uint8_t)i;
+    }
+    
+    int free_a = s_heap_free(a);
+    int free_again = s_heap_free(a);
+    int free_b = s_heap_free(b);
+    uint32_t free_after = s_heap_free_bytes();
+    
+    asm volatile ("nop"); // Breakpoint 1: 힙 서비스 확인 (a, b, free_again)
+    
+    // 2. secure 가 거부해야 하는 요청
+    int print_secure = s_print((const char *)SECURE_ADDRESS);
+    int free_secure = s_heap_free((void *)SECURE_ADDRESS);
+    int free_middle = -1;
+    uint8_t *c = s_heap_alloc(64);
+    /* c 가 칸을 쓰는 중에 반올림이 넘치는 크기 요청 */
+    void *huge = s_heap_alloc(0xFFFFFFFFu);
+    void *wrap = s_heap_alloc(0xFFFFFFE1u);
+    if (c) {
+        free_middle = s_heap_free(c + 4);
+        s_heap_free(c);
+    }
+    
+    // 3. 게이트웨이 비용
+    uint32_t loop = bench_loop();
+    uint32_t direct = bench_direct();
+    uint32_t gateway = bench_gateway();
+    uint32_t heap = bench_heap();
+    
+    asm volatile ("nop"); // Breakpoint 2: 측정 종료 (direct, gateway)
+    print_string("\n");
+    print_padded("call (x1000)", NAME_WIDTH);
+    print_string("   cycles  net/call\n");
+    print_string("----------------------------------------------------\n");
+    print_bench("loop only", loop, loop);
+    print_bench("direct call (NS -> NS)", direct, loop);
+    print_bench("gateway call (NS -> S -> NS)", gateway, loop);
+    print_bench("s_heap_alloc + s_heap_free", heap, loop);
+    
+    print_string("\n결과 검증 (non-secure):\n");
+    check("s_add 게이트웨이 결과", s_add(2, 3) == 5);
+    check("s_heap_alloc: NS 힙 안, 32바이트 정렬, 겹치지 않음",
+          in_heap(a, 100) && in_heap(b, 64) && ((uint32_t)a % 32) == 0 && ((uint32_t)b % 32) == 0 &&
+          (b >= a + 128 || a >= b + 64));
+    check("NS 가 할당 블록을 읽고 씀", pattern_ok);
+    check("free bytes: 128 + 64 사용 후 원래대로",
+          free_before - free_used == 192 && free_after == free_before);
+    check("s_heap_free: 정상 0, 이중 해제 -1", free_a == 0 && free_b == 0 && free_again == -1);
+    check("secure 주소 문자열/포인터 거부", print_secure == -1 && free_secure == -1);
+    check("블록 중간 포인터 해제 거부", c && free_middle == -1);
+    check("s_heap_alloc(0xFFFFFFFF / 0xFFFFFFE1) -> NULL", c && huge == 0 && wrap == 0);
+    check("게이트웨이 호출이 직접 호출보다 비쌈", gateway > direct && direct > loop);
+    
+    print_string("\n");
+    if (failures) {
+        print_number(failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        s_exit(1);
+    }
+    print_string("모든 검사 통과\n");
+    s_exit(0);
+    
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Secure 부트 (리셋 벡터 0x10000000)
+ *
+ * 표준 스타트업: .data 복사, .bss 초기화 후 main 진입.
+ * main 은 SAU/MPC 를 설정한 뒤 Non-secure 이미지로 BLXNS 합니다.
+ */
+
+    .syntax unified
+    .thumb
+
+.section .isr_vector
+    .long    __StackTop         /* Initial Top of Stack (MSP_S) */
+    .long    Reset_Handler      /* Reset Handler */
+    .long    Default_Handler    /* NMI */
+    .long    Fault_Handler      /* HardFault */
+    .long    Default_Handler    /* MemManage */
+    .long    Default_Handler    /* BusFault */
+    .long    Default_Handler    /* UsageFault */
+    .long    Fault_Handler      /* SecureFault - NS 의 잘못된 secure 접근 (main.c) */
+    .long    0
+    .long    0
+    .long    0
+    .long    Default_Handler    /* SVCall */
+    .long    Default_Handler    /* DebugMonitor */
+    .long    0
+    .long    Default_Handler    /* PendSV */
+    .long    Default_Handler    /* SysTick */
+
+.text
+.thumb_func
+.global Reset_Handler
+Reset_Handler:
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
+
+    ldr     R0, = main
+    bx      R0
+
+.thumb_func
+.global Default_Handler
+Default_Handler:
+    b       Default_Handler
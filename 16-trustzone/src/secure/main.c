@@ -0,0 +1,202 @@
+/*
+ * Cortex-M33 TrustZone 실습 예제 - Secure 이미지
+ * SAU/MPC 를 링커 심볼로 설정하고, NSC 베니어로 서비스를 내보낸 뒤 Non-secure 이미지로 전환
+ */
+
+#include <stdint.h>
+#include <arm_cmse.h>
+#include "tz.h"
+
+/* regions.ld / secure.ld 가 정의하는 배치 심볼 */
+extern uint32_t __ns_region_start, __ns_region_end;
+extern uint32_t __sg_start, __sg_end;
+
+void s_heap_init(void);     /* services.c */
+
+/* Non-secure 진입점: BLXNS 로 호출되고 반환하지 않음 (레지스터는 컴파일러가 정리) */
+typedef void __attribute__((cmse_nonsecure_call)) ns_entry_t(void);
+
+// Semihosting을 위한 함수 선언
+int print_string(const char *str) {
+    register int r0 asm("r0");
+    register int r1 asm("r1");
+    
+    r0 = 0x04;  /* SYS_WRITE0 */
+    r1 = (int)str;
+    
+    asm volatile ("bkpt #0xAB" : "=r"(r0) : "r"(r0), "r"(r1) : "memory");
+    return r0;
+}
+
+void print_hex(uint32_t value) {
+    char buffer[11];
+    
+    buffer[0] = '0';
+    buffer[1] = 'x';
+    for (int i = 0; i < 8; i++) {
+        uint32_t digit = (value >> (28 - i * 4)) & 0xF;
+        buffer[2 + i] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    }
+    buffer[10] = '\0';
+    print_string(buffer);
+}
+
+void print_number(unsigned int value, int width) {
+    char buffer[12];
+    int i = 11;
+    
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+        width--;
+    } while (value > 0 && i > 0);
+    while (width-- > 0 && i > 0) {
+        buffer[--i] = ' ';
+    }
+    print_string(&buffer[i]);
+}
+
+void exit_program(int code) {
+    register int r0 asm("r0");
+    register int r1 asm("r1");
+    
+    r0 = 0x18;  /* SYS_EXIT */
+    r1 = code == 0 ? 0x20026 : 0x20023;  /* ApplicationExit / RunTimeErrorUnknown */
+    
+    asm volatile ("bkpt #0xAB" : : "r"(r0), "r"(r1) : "memory");
+    while (1);
+}
+
+/* HardFault / SecureFault: NS 가 베니어가 아닌 secure 주소로 들어오거나 secure 메모리를 읽은 경우 */
+void Fault_Handler(void) {
+    print_string("\n[secure] fault: SFSR=");
+    print_hex(SCB_SFSR);
+    print_string(" SFAR=");
+    print_hex(SCB_SFAR);
+    print_string("\n");
+    exit_program(1);
+}
+
+// ========== SAU / MPC ==========
+
+static void sau_set_region(uint32_t n, uint32_t start, uint32_t end, int nsc) {
+    SAU_RNR = n;
+    SAU_RBAR = start & ~31u;
+    SAU_RLAR = ((end - 1) & ~31u) | (nsc ? SAU_RLAR_NSC : 0) | SAU_RLAR_ENABLE;
+}
+
+static uint32_t mpc_block_size(void) {
+    return 1u << (MPC_BLK_CFG + 5);
+}
+
+/* [start, end) 를 덮는 SSRAM1 블록을 Non-secure 로. 블록 경계에 맞지 않으면 -1 */
+static int mpc_set_ns(uint32_t start, uint32_t end) {
+    uint32_t block = mpc_block_size();
+    uint32_t first = (start & MPC_SSRAM1_MASK) / block;
+    uint32_t last = ((end - 1) & MPC_SSRAM1_MASK) / block;
+    
+    if ((start | end) & (block - 1)) return -1;
+    if (last / 32 > MPC_BLK_MAX) return -1;
+    
+    for (uint32_t b = first; b <= last; b++) {
+        uint32_t lut;
+        
+        MPC_BLK_IDX = b / 32;
+        lut = MPC_BLK_LUT;
+        MPC_BLK_IDX = b / 32;
+        MPC_BLK_LUT = lut | (1u << (b % 32));
+    }
+    return 0;
+}
+
+/*
+ * 영역 0: NSC  = 링커가 모은 SG 베니어 (.gnu.sgstubs)
+ * 영역 1: NS   = Non-secure 이미지 + NS 힙
+ * 나머지는 SAU 기본값(Secure). 0x1xxxxxxx 의 NSC 는 IDAU 쪽 NSCCFG 도 허용해야 합니다.
+ */
+static int tz_init(void) {
+    uint32_t ns_start = (uint32_t)&__ns_region_start;
+    uint32_t ns_end = (uint32_t)&__ns_region_end;
+    
+    SPCB_NSCCFG |= NSCCFG_CODENSC;
+    sau_set_region(0, (uint32_t)&__sg_start, (uint32_t)&__sg_end, 1);
+    sau_set_region(1, ns_start, ns_end, 0);
+    SAU_CTRL = SAU_CTRL_ENABLE;
+    SCB_SHCSR |= SHCSR_SECUREFAULTENA;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+    
+    return mpc_set_ns(ns_start, ns_end);
+}
+
+static void print_region(const char *name, uint32_t start, uint32_t end, const char *attr) {
+    print_string(name);
+    print_hex(start);
+    print_string(" - ");
+    print_hex(end - 1);
+    print_string("  ");
+    print_string(attr);
+    print_string("\n");
+}
+
+static int failures;
+
+static void check(const char *name, int ok) {
+    print_string(ok ? "  OK        " : "  MISMATCH  ");
+    print_string(name);
+    print_string("\n");
+    if (!ok) failures++;
+}
+
+int main(void) {
+    uint32_t ns_start = (uint32_t)&__ns_region_start;
+    uint32_t sg_start = (uint32_t)&__sg_start;
+    uint32_t sg_end = (uint32_t)&__sg_end;
+    
+    print_string("=== Cortex-M33 TrustZone: Secure 부트 ===\n");
+    
+    int mpc_ok = tz_init() == 0;
+    s_heap_init();
+    
+    asm volatile ("nop"); // Breakpoint 1: SAU/MPC 설정 완료
+    print_string("\nSAU (SREGION = ");
+    print_number(SAU_TYPE & 0xFF, 0);
+    print_string(")\n");
+    print_region("  0  ", sg_start, sg_end, "NSC (SG veneers)");
+    print_region("  1  ", ns_start, (uint32_t)&__ns_region_end, "NS  (image + heap)");
+    print_string("  -  나머지 Secure\n");
+    print_string("MPC SSRAM1 block: ");
+    print_number(mpc_block_size(), 0);
+    print_string(" bytes\n");
+    print_string("SG veneers: ");
+    print_number(sg_end - sg_start, 0);     /* 베니어 하나 = SG + B.W 8바이트, 32바이트 정렬 */
+    print_string(" bytes\n");
+    
+    /* TT 명령: 현재 SAU/IDAU 가 주소를 어떻게 판정하는지 */
+    cmse_address_info_t ns_info = cmse_TT((void *)ns_start);
+    cmse_address_info_t sg_info = cmse_TT((void *)sg_start);
+    
+    print_string("\n결과 검증 (secure):\n");
+    check("MPC: NS 영역이 블록 경계에 맞음", mpc_ok);
+    check("TT: NS 이미지 주소는 Non-secure (SAU 영역 1)",
+          !ns_info.flags.secure && ns_info.flags.sau_region_valid && ns_info.flags.sau_region == 1);
+    check("TT: 베니어 주소는 Secure (SAU 영역 0 = NSC)",
+          sg_info.flags.secure && sg_info.flags.sau_region_valid && sg_info.flags.sau_region == 0);
+    if (failures) {
+        print_string("\nSecure 설정 실패 - Non-secure 로 전환하지 않음\n");
+        exit_program(1);
+    }
+    
+    /* Non-secure 벡터 테이블: VTOR_NS, MSP_NS 설정 후 Reset_Handler 로 BLXNS */
+    uint32_t *ns_vectors = (uint32_t *)ns_start;
+    SCB_NS_VTOR = ns_start;
+    __asm volatile ("msr msp_ns, %0" : : "r"(ns_vectors[0]));
+    
+    print_string("\nNon-secure 이미지로 전환 (BLXNS)\n\n");
+    asm volatile ("nop"); // Breakpoint 2: Non-secure 진입 직전
+    ns_entry_t *ns_reset = cmse_nsfptr_create((ns_entry_t *)ns_vectors[1]);
+    ns_reset();
+    
+    /* NS 는 s_exit 으로 끝나므로 여기로 돌아오지 않음 */
+    exit_program(1);
+}
@@ -0,0 +1,121 @@
+/*
+ * Secure 서비스 - cmse_nonsecure_entry 함수 (NSC 베니어 경유로만 호출됨)
+ *
+ * Non-secure 가 넘긴 포인터는 그대로 믿지 않습니다.
+ *   - TT 명령(cmse_check_address_range)으로 NS 메모리인지 확인
+ *   - 문자열은 secure 버퍼로 복사한 뒤 사용 (확인 후 NS 가 내용을 바꾸는 경우 대비)
+ *   - 힙 메타데이터는 secure RAM 에 두어 NS 가 덮어쓸 수 없음
+ */
+
+#include <stdint.h>
+#include <arm_cmse.h>
+#include "services.h"
+
+/* main.c */
+int print_string(const char *str);
+void exit_program(int code);
+
+extern uint32_t __ns_heap_start, __ns_heap_end;
+
+// ========== 콘솔 ==========
+
+#define PRINT_CHUNK     64
+#define TT_GRANULE      32      /* SAU / MPU 영역 최소 단위: 32바이트 안에서는 속성이 같음 */
+
+SECURE_ENTRY int s_print(const char *str) {
+    char buffer[PRINT_CHUNK + 1];
+    const char *p = str;
+    int total = 0;
+    
+    while (1) {
+        int n = 0;
+        
+        while (n < PRINT_CHUNK) {
+            /* 청크 시작과 32바이트 경계마다 TT 로 확인 */
+            if (n == 0 || ((uint32_t)p & (TT_GRANULE - 1)) == 0) {
+                if (!cmse_check_address_range((void *)p, 1, CMSE_NONSECURE | CMSE_MPU_READ)) {
+                    return -1;
+                }
+            }
+            char c = *p;
+            if (c == '\0') break;
+            buffer[n++] = c;
+            p++;
+        }
+        buffer[n] = '\0';
+        if (n) print_string(buffer);
+        total += n;
+        if (n < PRINT_CHUNK) return total;
+    }
+}
+
+SECURE_ENTRY void s_exit(int code) {
+    exit_program(code);
+}
+
+SECURE_ENTRY uint32_t s_add(uint32_t a, uint32_t b) {
+    return a + b;
+}
+
+// ========== NS 힙 (first-fit, 32바이트 칸) ==========
+
+#define HEAP_GRANULE        32
+#define HEAP_MAX_GRANULES   2048    /* 64KB */
+
+static uint8_t granule_used[HEAP_MAX_GRANULES];
+static uint16_t granule_run[HEAP_MAX_GRANULES];    /* 할당 시작 칸: 칸 수, 그 외 0 */
+static uint32_t heap_granules;
+static uint32_t heap_free_granules;
+
+void s_heap_init(void) {
+    uint32_t size = (uint32_t)&__ns_heap_end - (uint32_t)&__ns_heap_start;
+    
+    heap_granules = size / HEAP_GRANULE;
+    if (heap_granules > HEAP_MAX_GRANULES) heap_granules = HEAP_MAX_GRANULES;
+    heap_free_granules = heap_granules;
+}
+
+/* size 는 NS 가 준 값: 반올림 전에 범위를 검사 (0xFFFFFFE1 이상이면 need 가 0 으로 넘침) */
+SECURE_ENTRY void *s_heap_alloc(uint32_t size) {
+    uint32_t need;
+    uint32_t run = 0;
+    
+    if (size == 0 || size > heap_granules * HEAP_GRANULE) return 0;
+    need = (size + HEAP_GRANULE - 1) / HEAP_GRANULE;
+    if (need > heap_free_granules) return 0;
+    
+    for (uint32_t i = 0; i < heap_granules; i++) {
+        run = granule_used[i] ? 0 : run + 1;
+        if (run == need) {
+            uint32_t start = i + 1 - need;
+            
+            for (uint32_t j = start; j <= i; j++) {
+                granule_used[j] = 1;
+            }
+            granule_run[start] = need;
+            heap_free_granules -= need;
+            return (void *)((uint32_t)&__ns_heap_start + start * HEAP_GRANULE);
+        }
+    }
+    return 0;
+}
+
+/* 힙 밖, 칸 중간, 이미 해제된 포인터는 거부 */
+SECURE_ENTRY int s_heap_free(void *ptr) {
+    uint32_t offset = (uint32_t)ptr - (uint32_t)&__ns_heap_start;
+    uint32_t index = offset / HEAP_GRANULE;
+    
+    if (offset >= heap_granules * HEAP_GRANULE || (offset % HEAP_GRANULE) != 0) return -1;
+    if (granule_run[index] == 0) return -1;
+    
+    for (uint32_t j = index; j < index + granule_run[index]; j++) {
+        granule_used[j] = 0;
+    }
+    heap_free_granules += granule_run[index];
+    granule_run[index] = 0;
+    return 0;
+}
+
+SECURE_ENTRY uint32_t s_heap_free_bytes(void) {
+    return heap_free_granules * HEAP_GRANULE;
+}
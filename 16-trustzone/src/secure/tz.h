@@ -0,0 +1,40 @@
+/*
+ * TrustZone 설정 레지스터 (MPS2-AN505, Secure 전용)
+ */
+
+#ifndef TZ_H
+#define TZ_H
+
+#include <stdint.h>
+
+/* SAU: 영역 단위 32바이트, RLAR 의 LADDR 은 영역 마지막 32바이트 블록의 주소 */
+#define SAU_CTRL            (*(volatile uint32_t *)0xE000EDD0)
+#define SAU_TYPE            (*(volatile uint32_t *)0xE000EDD4)
+#define SAU_RNR             (*(volatile uint32_t *)0xE000EDD8)
+#define SAU_RBAR            (*(volatile uint32_t *)0xE000EDDC)
+#define SAU_RLAR            (*(volatile uint32_t *)0xE000EDE0)
+#define SAU_CTRL_ENABLE     (1u << 0)
+#define SAU_RLAR_ENABLE     (1u << 0)
+#define SAU_RLAR_NSC        (1u << 1)
+
+#define SCB_SHCSR           (*(volatile uint32_t *)0xE000ED24)
+#define SHCSR_SECUREFAULTENA (1u << 19)
+#define SCB_SFSR            (*(volatile uint32_t *)0xE000EDE4)
+#define SCB_SFAR            (*(volatile uint32_t *)0xE000EDE8)
+
+/* Non-secure 별칭 SCB (0xE002xxxx): secure 에서 NS 뱅크 레지스터 접근 */
+#define SCB_NS_VTOR         (*(volatile uint32_t *)0xE002ED08)
+
+/* IDAU: 0x1xxxxxxx 영역을 NSC 로 지정하려면 Secure Privilege Control 의 NSCCFG.CODENSC 필요 */
+#define SPCB_NSCCFG         (*(volatile uint32_t *)0x50080014)
+#define NSCCFG_CODENSC      (1u << 0)
+
+/* SSRAM1 MPC: LUT 비트 1 = 해당 블록 Non-secure 전용, 0 = Secure 전용 (리셋 값) */
+#define MPC_SSRAM1_BASE     0x58007000u
+#define MPC_BLK_MAX         (*(volatile uint32_t *)(MPC_SSRAM1_BASE + 0x10))
+#define MPC_BLK_CFG         (*(volatile uint32_t *)(MPC_SSRAM1_BASE + 0x14))  /* 블록 = 1 << (CFG + 5) 바이트 */
+#define MPC_BLK_IDX         (*(volatile uint32_t *)(MPC_SSRAM1_BASE + 0x18))
+#define MPC_BLK_LUT         (*(volatile uint32_t *)(MPC_SSRAM1_BASE + 0x1C))
+#define MPC_SSRAM1_MASK     0x0FFFFFFFu /* 별칭 주소 -> SSRAM1 안 물리 오프셋 */
+
+#endif /* TZ_H */
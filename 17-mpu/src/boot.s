@@ -0,0 +1,72 @@
+/*
+ * Cortex-M33 MPU
+ * 표준 스타트업: .data 복사, .bss 초기화 후 main 진입
+ */
+
+    .syntax unified
+    .thumb
+
+    .section .isr_vector
+    .long   __StackTop           /* MSP initial value */
+    .long   Reset_Handler        /* Reset Handler */
+    .long   Default_Handler      /* NMI */
+    .long   HardFault_Handler    /* HardFault */
+    .long   MemManage_Handler    /* MemManage - MPU 위반 (main.c) */
+    .long   Default_Handler      /* BusFault */
+    .long   Default_Handler      /* UsageFault */
+    .long   Default_Handler      /* SecureFault */
+    .long   0
+    .long   0
+    .long   0
+    .long   Default_Handler      /* SVCall */
+    .long   Default_Handler      /* DebugMonitor */
+    .long   0
+    .long   Default_Handler      /* PendSV */
+    .long   Default_Handler      /* SysTick */
+
+    .text
+    .thumb_func
+    .global Reset_Handler
+Reset_Handler:
+    /* 스택 포인터 설정 */
+    ldr r0, =__StackTop
+    mov sp, r0
+
+    /* .data 초기값 복사 (LMA _sidata -> VMA _sdata) */
+    ldr     r0, =_sdata
+    ldr     r1, =_edata
+    ldr     r2, =_sidata
+    cmp     r0, r2                   /* LMA == VMA 이면 건너뜀 (01-main-execution/README.md) */
+    beq     copy_done
+copy_data:
+    cmp     r0, r1
+    bhs     copy_done
+    ldr     r3, [r2], #4
+    str     r3, [r0], #4
+    b       copy_data
+copy_done:
+
+    /* .bss 0으로 초기화 */
+    ldr     r0, =_sbss
+    ldr     r1, =_ebss
+    movs    r2, #0
+zero_bss:
+    cmp     r0, r1
+    bhs     zero_done
+    str     r2, [r0], #4
+    b       zero_bss
+zero_done:
+
+    /* main 함수 호출 */
+    bl main
+    
+hang:
+    b hang
+
+    .thumb_func
+    .weak HardFault_Handler
+HardFault_Handler:
+    .thumb_func
+    .global Default_Handler
+Default_Handler:
+    b Default_Handler
@@ -0,0 +1,416 @@
+/*
+ * Cortex-M33 MPU 실습 예제
+ * 링커 심볼로 만든 PMSAv8 영역, 스택 가드, MemManage 로 잡는 위반과 런타임 비용 비교
+ */
+
+#include <stdint.h>
+#include "mpu.h"
+#include "report.h"
+#include "dwt.h"
+
+#define WORK_WORDS      512     /* 벤치마크 버퍼 (힙 앞 2KB) */
+#define REPEAT          8
+#define OVERRUN_BLOCK   64
+#define OVERRUN_BYTES   16      /* 블록 끝을 넘겨 쓰는 양 */
+#define RECURSE_LIMIT   100000
+
+extern uint32_t __heap_start, __heap_end;
+extern uint32_t __psp_guard_start, __psp_limit, __psp_top;
+
+int probe_run(void (*fn)(void));    /* probe.s */
+void probe_abort(void);
+
+void print_hex(uint32_t value) {
+    char buffer[11];
+    
+    buffer[0] = '0';
+    buffer[1] = 'x';
+    for (int i = 0; i < 8; i++) {
+        uint32_t digit = (value >> (28 - i * 4)) & 0xF;
+        buffer[2 + i] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    }
+    buffer[10] = '\0';
+    print_string(buffer);
+}
+
+// ========== 측정 통계 ==========
+
+#define NAME_WIDTH 30
+
+// ========== MemManage ==========
+
+typedef struct {
+    volatile uint32_t count;
+    volatile uint32_t mmfsr;
+    volatile uint32_t mmfar;    /* MMARVALID 일 때만 */
+    volatile uint32_t pc;       /* 스태킹이 성공했을 때 위반 명령어 주소 */
+} fault_record_t;
+
+static fault_record_t fault;
+static volatile int probe_active;
+
+/*
+ * 위반 기록 후, probe 중이면 PSP 맨 위에 probe_abort 로 돌아가는 새 프레임을 만듭니다.
+ * 스택 오버플로처럼 원래 프레임이 가드에 걸쳐 있어도(MSTKERR) 새 프레임은 항상 유효합니다.
+ */
+void MemManage_Handler(void) {
+    uint32_t mmfsr = SCB_CFSR & 0xFF;
+    uint32_t *frame;
+    
+    fault.mmfsr = mmfsr;
+    fault.mmfar = (mmfsr & MMFSR_MMARVALID) ? SCB_MMFAR : 0;
+    fault.pc = 0;
+    if (!(mmfsr & MMFSR_MSTKERR)) {
+        __asm volatile ("mrs %0, psp" : "=r"(frame));
+        fault.pc = frame[6];
+    }
+    fault.count++;
+    SCB_CFSR = mmfsr;   /* 쓰기 1 로 지움 */
+    
+    if (!probe_active) {
+        print_string("\nMemManage outside probe: MMFSR=");
+        print_hex(mmfsr);
+        print_string(" MMFAR=");
+        print_hex(fault.mmfar);
+        print_string("\n");
+        exit_program(1);
+    }
+    
+    frame = &__psp_top - 8;
+    for (int i = 0; i < 6; i++) {
+        frame[i] = 0;                       /* r0-r3, r12, lr */
+    }
+    frame[6] = (uint32_t)probe_abort & ~1u; /* pc */
+    frame[7] = 0x01000000;                  /* xPSR: Thumb */
+    __asm volatile ("msr psp, %0" : : "r"(frame) : "memory");
+}
+
+void HardFault_Handler(void) {
+    print_string("\nHardFault: CFSR=");
+    print_hex(SCB_CFSR);
+    print_string("\n");
+    exit_program(1);
+}
+
+typedef struct {
+    const char *name;
+    int faulted;
+    uint32_t mmfsr;
+    uint32_t mmfar;
+    uint32_t pc;
+} probe_result_t;
+
+static void run_probe(probe_result_t *r, const char *name, void (*fn)(void)) {
+    fault.count = 0;
+    fault.mmfsr = 0;
+    fault.mmfar = 0;
+    fault.pc = 0;
+    probe_active = 1;
+    r->faulted = probe_run(fn);
+    probe_active = 0;
+    r->name = name;
+    r->mmfsr = fault.mmfsr;
+    r->mmfar = fault.mmfar;
+    r->pc = fault.pc;
+}
+
+static void print_probe(const probe_result_t *r) {
+    print_padded(r->name, NAME_WIDTH);
+    if (!r->faulted) {
+        print_string("ok\n");
+        return;
+    }
+    print_string("fault  ");
+    print_hex(r->mmfsr);
+    print_string("  ");
+    if (r->mmfsr & MMFSR_MMARVALID) {
+        print_hex(r->mmfar);
+    } else {
+        print_string("    -     ");
+    }
+    print_string("  ");
+    if (r->pc) {
+        print_hex(r->pc);
+    } else {
+        print_string("    -");
+    }
+    print_string("\n");
+}
+
+// ========== 힙 (bump) ==========
+
+static uint8_t *heap_next;
+
+static void heap_reset(void) {
+    heap_next = (uint8_t *)&__heap_start;
+}
+
+static void *heap_alloc(uint32_t size) {
+    uint8_t *block = heap_next;
+    
+    size = (size + 7) & ~7u;
+    if (block + size > (uint8_t *)&__heap_end) return 0;
+    heap_next = block + size;
+    return block;
+}
+
+static uint32_t heap_size(void) {
+    return (uint32_t)&__heap_end - (uint32_t)&__heap_start;
+}
+
+// ========== 위반 probe ==========
+
+static volatile uint32_t sink;
+const uint32_t ro_table[4] = { 1, 2, 3, 4 };
+static uint16_t ram_code[2] = { 0x4770, 0xBF00 };  /* bx lr; nop - .data (XN) */
+
+static void probe_legal(void) {
+    uint32_t *word = heap_alloc(4);
+    *word = *(volatile const uint32_t *)&ro_table[1];
+    sink = *word;
+}
+
+static void probe_null_read(void) {
+    sink = *(volatile uint32_t *)0;
+}
+
+static void probe_rodata_write(void) {
+    *(volatile uint32_t *)&ro_table[2] = 0xDEAD;
+}
+
+static void probe_text_write(void) {
+    *(volatile uint32_t *)((uint32_t)probe_legal & ~1u) = 0;
+}
+
+static void probe_exec_data(void) {
+    void (*code)(void) = (void (*)(void))((uint32_t)ram_code | 1);
+    code();
+}
+
+/* 힙 마지막 블록을 끝 너머까지 씀 -> 바로 위 PSP 가드 */
+static uint8_t *overrun_block;
+
+static void probe_heap_overrun(void) {
+    volatile uint8_t *p = overrun_block;
+    for (int i = 0; i < OVERRUN_BLOCK + OVERRUN_BYTES; i++) {
+        p[i] = (uint8_t)i;
+    }
+}
+
+static volatile uint32_t overflow_depth;
+
+/* 한 단계 프레임이 가드(256B)보다 작아야 가드를 건너뛰지 못함 */
+__attribute__((noinline)) static uint32_t recurse(uint32_t depth) {
+    volatile uint32_t pad[16];
+    
+    pad[0] = depth;
+    overflow_depth = depth;
+    if (depth >= RECURSE_LIMIT) return depth;
+    return recurse(depth + 1) + pad[0];
+}
+
+static void probe_stack_overflow(void) {
+    sink = recurse(1);
+}
+
+static void prepare_overrun(void) {
+    heap_reset();
+    heap_alloc(heap_size() - OVERRUN_BLOCK);
+    overrun_block = heap_alloc(OVERRUN_BLOCK);
+}
+
+// ========== 비용 ==========
+
+/* 소프트웨어 검사: 접근마다 힙 범위 비교 */
+static uint32_t bounds_errors;
+
+static inline void checked_store(uint32_t *p, uint32_t value) {
+    if (p < &__heap_start || p + 1 > &__heap_end) {
+        bounds_errors++;
+        return;
+    }
+    *p = value;
+}
+
+static inline uint32_t checked_load(const uint32_t *p) {
+    if (p < &__heap_start || p + 1 > &__heap_end) {
+        bounds_errors++;
+        return 0;
+    }
+    return *p;
+}
+
+__attribute__((noinline)) static uint32_t work_plain(uint32_t *buf) {
+    uint32_t sum = 0;
+    
+    for (int i = 0; i < WORK_WORDS; i++) {
+        buf[i] = i * 3 + 1;
+    }
+    __asm volatile ("" : : : "memory");
+    for (int i = 0; i < WORK_WORDS; i++) {
+        sum += buf[i];
+    }
+    return sum;
+}
+
+__attribute__((noinline)) static uint32_t work_checked(uint32_t *buf) {
+    uint32_t sum = 0;
+    
+    for (int i = 0; i < WORK_WORDS; i++) {
+        checked_store(&buf[i], i * 3 + 1);
+    }
+    __asm volatile ("" : : : "memory");
+    for (int i = 0; i < WORK_WORDS; i++) {
+        sum += checked_load(&buf[i]);
+    }
+    return sum;
+}
+
+static stats_t work_off, work_on, work_sw, init_stats, fault_trip;
+static uint32_t sum_off, sum_on, sum_sw;
+
+static void measure_cost(void) {
+    uint32_t *buf = (uint32_t *)&__heap_start;
+    
+    for (int r = 0; r < REPEAT; r++) {
+        uint32_t start;
+    
+        mpu_disable();
+        start = dwt_cycles();
+        sum_off = work_plain(buf);
+        stats_add(&work_off, dwt_elapsed(start));
+    
+        start = dwt_cycles();
+        sum_sw = work_checked(buf);
+        stats_add(&work_sw, dwt_elapsed(start));
+    
+        start = dwt_cycles();
+        mpu_init();
+        mpu_enable();
+        stats_add(&init_stats, dwt_elapsed(start));
+    
+        start = dwt_cycles();
+        sum_on = work_plain(buf);
+        stats_add(&work_on, dwt_elapsed(start));
+    
+        /* 위반 1회: 접근 -> MemManage -> probe_abort -> 호출자 */
+        probe_result_t r_trip;
+        start = dwt_cycles();
+        run_probe(&r_trip, "null", probe_null_read);
+        stats_add(&fault_trip, dwt_elapsed(start));
+    }
+}
+
+// ========== main ==========
+
+int main(void) {
+    print_string("=== Cortex-M33 MPU: 링커 심볼 영역과 MemManage ===\n");
+    
+    dwt_init();
+    int region_count = mpu_init();
+    mpu_print();
+    print_string("DREGION = ");
+    print_number((MPU_TYPE >> 8) & 0xFF, 0);
+    print_string(", PSP guard ");
+    print_hex((uint32_t)&__psp_guard_start);
+    print_string(" - ");
+    print_hex((uint32_t)&__psp_limit - 1);
+    print_string(" (영역 없음)\n");
+    
+    // 1. MPU 꺼진 상태: 힙 오버런이 이웃(가드 자리)을 조용히 덮어씀
+    probe_result_t silent;
+    volatile uint8_t *guard = (volatile uint8_t *)&__psp_guard_start;
+    guard[0] = 0;
+    prepare_overrun();
+    run_probe(&silent, "heap overrun (MPU off)", probe_heap_overrun);
+    int silently_corrupted = !silent.faulted && guard[0] == OVERRUN_BLOCK;
+    guard[0] = 0;
+    
+    // 2. MPU 켜고 위반 probe
+    mpu_enable();
+    
+    probe_result_t legal, null_read, ro_write, text_write, exec_data, overrun, overflow;
+    heap_reset();
+    run_probe(&legal, "legal heap/rodata access", probe_legal);
+    run_probe(&null_read, "NULL read", probe_null_read);
+    run_probe(&ro_write, "write .rodata", probe_rodata_write);
+    run_probe(&text_write, "write .text", probe_text_write);
+    run_probe(&exec_data, "execute from .data", probe_exec_data);
+    prepare_overrun();
+    run_probe(&overrun, "heap overrun (MPU on)", probe_heap_overrun);
+    overflow_depth = 0;
+    run_probe(&overflow, "stack overflow (recursion)", probe_stack_overflow);
+    
+    /* 가드는 MPU 가 켜져 있으면 특권 코드도 읽을 수 없음 */
+    mpu_disable();
+    uint8_t guard_after = guard[0];
+    mpu_enable();
+    
+    asm volatile ("nop"); // Breakpoint 1: probe 종료 (fault, overflow_depth)
+    print_string("\n");
+    print_padded("probe", NAME_WIDTH);
+    print_string("result MMFSR       MMFAR       PC\n");
+    print_string("---------------------------------------------------------------------------\n");
+    print_probe(&silent);
+    print_probe(&legal);
+    print_probe(&null_read);
+    print_probe(&ro_write);
+    print_probe(&text_write);
+    print_probe(&exec_data);
+    print_probe(&overrun);
+    print_probe(&overflow);
+    print_string("recursion depth at fault: ");
+    print_number(overflow_depth, 0);
+    print_string("\n");
+    
+    // 3. 비용
+    measure_cost();
+    mpu_enable();
+    
+    asm volatile ("nop"); // Breakpoint 2: 측정 종료 (work_off, work_on, work_sw)
+    print_string("\n");
+    print_padded("cycles", NAME_WIDTH);
+    print_string("     min     avg     max  samples\n");
+    print_string("---------------------------------------------------------------\n");
+    print_stats("workload, MPU off", NAME_WIDTH, &work_off);
+    print_stats("workload, MPU on", NAME_WIDTH, &work_on);
+    print_stats("workload + sw bounds checks", NAME_WIDTH, &work_sw);
+    print_stats("mpu_init + enable (once)", NAME_WIDTH, &init_stats);
+    print_stats("fault -> handler -> resume", NAME_WIDTH, &fault_trip);
+    
+    print_string("\n결과 검증:\n");
+    uint32_t overflow_far = overflow.mmfar;
+    uint32_t text_addr = (uint32_t)probe_legal & ~1u;
+    check("MPU 영역 설정 (DREGION 충분)", region_count > 0);
+    check("MPU 꺼짐: 힙 오버런이 fault 없이 가드를 덮어씀", silently_corrupted);
+    check("정상 접근은 fault 없음", !legal.faulted);
+    check("NULL 읽기: DACCVIOL, MMFAR = 0",
+          null_read.faulted && (null_read.mmfsr & MMFSR_DACCVIOL) && null_read.mmfar == 0);
+    check(".rodata 쓰기: DACCVIOL, 값 보존",
+          ro_write.faulted && (ro_write.mmfsr & MMFSR_DACCVIOL) &&
+          ro_write.mmfar == (uint32_t)&ro_table[2] && *(volatile const uint32_t *)&ro_table[2] == 3);
+    check(".text 쓰기: DACCVIOL", text_write.faulted && text_write.mmfar == text_addr);
+    check(".data 실행: IACCVIOL, PC = 코드 주소",
+          exec_data.faulted && (exec_data.mmfsr & MMFSR_IACCVIOL) &&
+          exec_data.pc == (uint32_t)ram_code);
+    check("힙 오버런: __heap_end 에서 정지, 가드 보존",
+          overrun.faulted && overrun.mmfar == (uint32_t)&__heap_end &&
+          mpu_region_of(overrun.mmfar) < 0 && guard_after == 0);
+    check("스택 오버플로: PSP 가드에서 정지",
+          overflow.faulted && overflow_depth > 1 && overflow_depth < RECURSE_LIMIT &&
+          ((overflow.mmfsr & MMFSR_MSTKERR) ||
+           (overflow_far >= (uint32_t)&__psp_guard_start && overflow_far < (uint32_t)&__psp_limit)));
+    check("작업 결과 동일 (off / on / sw)", sum_off == sum_on && sum_off == sum_sw && bounds_errors == 0);
+    check("MPU 켜도 작업 비용 동일 (5% 이내)",
+          stats_avg(&work_on) <= stats_avg(&work_off) + stats_avg(&work_off) / 20);
+    check("소프트웨어 검사는 더 비쌈", stats_avg(&work_sw) > stats_avg(&work_on));
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
@@ -0,0 +1,111 @@
+/*
+ * 링커 심볼 기반 MPU 영역 설정
+ *
+ * 가드(PSP/MSP 스택 아래)와 주소 0 근처는 일부러 어느 영역에도 넣지 않습니다.
+ * PRIVDEFENA = 0 이므로 특권 코드라도 그 주소에 닿으면 MemManage 가 납니다.
+ * 접근마다 소프트웨어 검사를 하지 않고, 검사는 MPU 하드웨어가 매 접근에 병렬로 합니다.
+ */
+
+#include "mpu.h"
+#include "report.h"
+
+void print_hex(uint32_t value);     /* main.c */
+
+extern const uint32_t __text_start, __text_end;
+extern const uint32_t __rodata_start, __rodata_end;
+extern uint32_t __rw_start, __rw_end;
+extern uint32_t __heap_start, __heap_end;
+extern uint32_t __psp_limit, __psp_top;
+extern uint32_t __msp_limit, __StackTop;
+
+/* CMSDK Timer0/1 + Dual Timer (dwt.c 가 Dual Timer 1 사용) */
+#define PERIPH_START    0x50000000u
+#define PERIPH_END      0x50003000u
+
+static const mpu_region_t regions[] = {
+    { "text",      &__text_start,   &__text_end,  MPU_AP_RO_PRIV,                  MPU_ATTR_NORMAL },
+    { "rodata",    &__rodata_start, &__rodata_end, MPU_AP_RO_PRIV | MPU_RBAR_XN,   MPU_ATTR_NORMAL },
+    { "data+bss",  &__rw_start,     &__rw_end,    MPU_AP_RW_PRIV | MPU_RBAR_XN,    MPU_ATTR_NORMAL },
+    { "heap",      &__heap_start,   &__heap_end,  MPU_AP_RW_PRIV | MPU_RBAR_XN,    MPU_ATTR_NORMAL },
+    { "psp stack", &__psp_limit,    &__psp_top,   MPU_AP_RW_PRIV | MPU_RBAR_XN,    MPU_ATTR_NORMAL },
+    { "msp stack", &__msp_limit,    &__StackTop,  MPU_AP_RW_PRIV | MPU_RBAR_XN,    MPU_ATTR_NORMAL },
+    { "timers",    (const void *)PERIPH_START, (const void *)PERIPH_END,
+                   MPU_AP_RW_PRIV | MPU_RBAR_XN, MPU_ATTR_DEVICE },
+};
+
+#define REGION_COUNT ((int)(sizeof(regions) / sizeof(regions[0])))
+
+int mpu_init(void) {
+    int available = (MPU_TYPE >> 8) & 0xFF;
+    
+    if (available < REGION_COUNT) return -1;
+    
+    mpu_disable();
+    MPU_MAIR0 = (0x04u << 8) | 0xFFu;
+    
+    for (int i = 0; i < available; i++) {
+        MPU_RNR = i;
+        if (i < REGION_COUNT) {
+            uint32_t start = (uint32_t)regions[i].start;
+            uint32_t end = (uint32_t)regions[i].end;
+    
+            MPU_RBAR = (start & ~31u) | MPU_SH_INNER | regions[i].access;
+            MPU_RLAR = ((end - 1) & ~31u) | (regions[i].attr << 1) | MPU_RLAR_EN;
+        } else {
+            MPU_RLAR = 0;   /* 남은 영역 비활성 */
+        }
+    }
+    
+    SCB_SHCSR |= SHCSR_MEMFAULTENA;     /* 끄면 MemManage 가 HardFault 로 승격 */
+    return REGION_COUNT;
+}
+
+void mpu_enable(void) {
+    MPU_CTRL = MPU_CTRL_ENABLE;     /* PRIVDEFENA = 0: 가드 = 접근 불가 */
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+void mpu_disable(void) {
+    __asm volatile ("dmb" : : : "memory");
+    MPU_CTRL = 0;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+int mpu_region_of(uint32_t address) {
+    for (int i = 0; i < REGION_COUNT; i++) {
+        if (address >= (uint32_t)regions[i].start && address < (uint32_t)regions[i].end) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static const char *access_name(uint32_t access) {
+    switch (access) {
+    case MPU_AP_RO_PRIV:                return "RO  X ";
+    case MPU_AP_RO_PRIV | MPU_RBAR_XN:  return "RO  XN";
+    case MPU_AP_RW_PRIV | MPU_RBAR_XN:  return "RW  XN";
+    default:                            return "??    ";
+    }
+}
+
+void mpu_print(void) {
+    print_string("\n#  region      start        end (incl)   access\n");
+    print_string("-----------------------------------------------------\n");
+    for (int i = 0; i < REGION_COUNT; i++) {
+        char index[4] = { '0' + i, ' ', ' ', '\0' };
+        const char *name = regions[i].name;
+        int width = 12;
+    
+        print_string(index);
+        print_string(name);
+        while (*name++) width--;
+        while (width-- > 0) print_string(" ");
+        print_hex((uint32_t)regions[i].start);
+        print_string("   ");
+        print_hex((uint32_t)regions[i].end - 1);
+        print_string("   ");
+        print_string(access_name(regions[i].access));
+        print_string(regions[i].attr == MPU_ATTR_DEVICE ? " device\n" : "\n");
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * ARMv8-M PMSAv8 MPU (Secure 뱅크)
+ *
+ * 영역 = RBAR(시작, SH, AP, XN) + RLAR(끝, MAIR 인덱스, EN). 시작/끝은 32바이트 단위.
+ * PMSAv7 과 달리 크기가 2의 거듭제곱일 필요가 없고, 대신 영역끼리 겹치면 접근이 fault 입니다.
+ */
+
+#ifndef MPU_H
+#define MPU_H
+
+#include <stdint.h>
+
+#define MPU_TYPE            (*(volatile uint32_t *)0xE000ED90)  /* [15:8] DREGION */
+#define MPU_CTRL            (*(volatile uint32_t *)0xE000ED94)
+#define MPU_RNR             (*(volatile uint32_t *)0xE000ED98)
+#define MPU_RBAR            (*(volatile uint32_t *)0xE000ED9C)
+#define MPU_RLAR            (*(volatile uint32_t *)0xE000EDA0)
+#define MPU_MAIR0           (*(volatile uint32_t *)0xE000EDC0)
+
+#define MPU_CTRL_ENABLE     (1u << 0)
+#define MPU_CTRL_HFNMIENA   (1u << 1)
+#define MPU_CTRL_PRIVDEFENA (1u << 2)   /* 0: 어느 영역에도 없는 주소는 특권 모드에서도 fault */
+
+#define MPU_RBAR_XN         (1u << 0)
+#define MPU_AP_RW_PRIV      (0u << 1)
+#define MPU_AP_RW           (1u << 1)
+#define MPU_AP_RO_PRIV      (2u << 1)
+#define MPU_AP_RO           (3u << 1)
+#define MPU_SH_INNER        (3u << 3)
+
+#define MPU_RLAR_EN         (1u << 0)
+#define MPU_ATTR_NORMAL     0           /* MAIR0[7:0]  = 0xFF: Normal, write-back */
+#define MPU_ATTR_DEVICE     1           /* MAIR0[15:8] = 0x04: Device-nGnRE */
+
+#define SCB_SHCSR           (*(volatile uint32_t *)0xE000ED24)
+#define SHCSR_MEMFAULTENA   (1u << 16)
+#define SCB_CFSR            (*(volatile uint32_t *)0xE000ED28)  /* [7:0] MMFSR */
+#define SCB_MMFAR           (*(volatile uint32_t *)0xE000ED34)
+
+#define MMFSR_IACCVIOL      (1u << 0)   /* 실행 금지 영역에서 명령어 fetch */
+#define MMFSR_DACCVIOL      (1u << 1)   /* 데이터 접근 위반, MMFAR 유효 */
+#define MMFSR_MUNSTKERR     (1u << 3)
+#define MMFSR_MSTKERR       (1u << 4)   /* 예외 진입 스태킹 중 위반 (스택 오버플로) */
+#define MMFSR_MMARVALID     (1u << 7)
+
+typedef struct {
+    const char *name;
+    const void *start;      /* 링커 심볼 */
+    const void *end;
+    uint32_t access;        /* AP | XN */
+    uint32_t attr;          /* MAIR 인덱스 */
+} mpu_region_t;
+
+/* 링커 심볼로 영역 표를 채우고 MPU 설정 (활성화는 하지 않음). 설정한 영역 수 */
+int mpu_init(void);
+void mpu_enable(void);
+void mpu_disable(void);
+void mpu_print(void);
+
+/* 주소가 어느 영역에도 없으면 -1 (가드/NULL) */
+int mpu_region_of(uint32_t address);
+
+#endif /* MPU_H */
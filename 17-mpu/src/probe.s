@@ -0,0 +1,57 @@
+/*
+ * 보호된 실행: 함수를 PSP 스택에서 돌리고, MemManage 가 나면 호출자로 되돌아옴
+ *
+ *   int probe_run(void (*fn)(void));      0 = 정상 반환, 1 = MemManage 로 중단
+ *
+ * fn 은 __psp_top 부터 시작하는 프로세스 스택에서 실행됩니다. 스택 오버플로가 PSP 가드에 닿아도
+ * MemManage 핸들러는 MSP(메인 스택)에서 돌기 때문에 스태킹이 안전합니다.
+ * 핸들러는 PSP 맨 위에 probe_abort 로 돌아가는 새 예외 프레임을 만들고 복귀합니다.
+ */
+
+    .syntax unified
+    .thumb
+    .text
+
+    .thumb_func
+    .global probe_run
+    .type probe_run, %function
+probe_run:
+    push    {r3-r11, lr}            /* 호출 규약상 보존 레지스터 (r3 은 8바이트 정렬용) */
+    ldr     r1, =probe_saved_msp
+    mov     r2, sp
+    str     r2, [r1]
+
+    ldr     r1, =__psp_top
+    msr     psp, r1
+    mrs     r1, control
+    orr     r1, r1, #2              /* SPSEL = 1: 스레드가 PSP 사용 */
+    msr     control, r1
+    isb
+
+    blx     r0
+    movs    r0, #0
+
+probe_return:                       /* r0 = 결과 */
+    mrs     r1, control
+    bic     r1, r1, #2              /* SPSEL = 0: MSP 로 복귀 */
+    msr     control, r1
+    isb
+    ldr     r1, =probe_saved_msp
+    ldr     r1, [r1]
+    mov     sp, r1
+    pop     {r3-r11, pc}
+    .size probe_run, .-probe_run
+
+/* MemManage_Handler 가 만든 프레임의 복귀 주소 (스레드 모드, PSP) */
+    .thumb_func
+    .global probe_abort
+    .type probe_abort, %function
+probe_abort:
+    movs    r0, #1
+    b       probe_return
+    .size probe_abort, .-probe_abort
+
+    .bss
+    .align  2
+probe_saved_msp:
+    .space  4
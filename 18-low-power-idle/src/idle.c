@@ -0,0 +1,209 @@
+/*
+ * 이벤트 구동 idle 루프
+ *
+ * 스레드 모드 idle (TICKED, TICKLESS_WFI, TICKLESS_WFE):
+ *
+ *     cpsid i                  <- 검사와 잠 사이에 온 인터럽트를 놓치지 않게
+ *     할 일이 생겼으면 cpsie i, 다시 처리
+ *     알람 설정 (tickless)
+ *     wfi / wfe                <- PRIMASK 가 1 이어도 pending 인터럽트가 깨움
+ *     cpsie i                  <- 여기서 핸들러 실행
+ *
+ * SLEEPONEXIT: 스레드는 WFI 한 번으로 잠들고, 이후 모든 처리는 SysTick/Timer0 핸들러에서 합니다.
+ * 핸들러가 끝나면 스레드로 돌아가지 않고 바로 다시 잡니다. 끝낼 때 핸들러가 SLEEPONEXIT 를 지웁니다.
+ */
+
+#include "idle.h"
+#include "dwt.h"
+
+wheel_t idle_wheel;
+
+static idle_mode_t mode;
+static idle_report_t *report;
+static uint32_t epoch;
+static uint32_t end_tick;
+static uint32_t last_exit;      /* SLEEPONEXIT: 마지막 핸들러 종료 시각 */
+static volatile int done;
+
+uint32_t idle_now(void) {
+    return (dwt_cycles() - epoch) / TICK_CYCLES;
+}
+
+void idle_note_fired(const event_t *e) {
+    uint32_t late = dwt_cycles() - (epoch + e->expires * TICK_CYCLES);
+    
+    report->fired++;
+    report->late_sum += late;
+    if (late > report->late_max) report->late_max = late;
+}
+
+// ========== SysTick 알람 ==========
+
+static void alarm_periodic(void) {
+    SYST_CSR = 0;
+    SYST_RVR = TICK_CYCLES - 1;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_CLKSOURCE | SYST_CSR_TICKINT | SYST_CSR_ENABLE;
+}
+
+/* tick 시각에 한 번 (24비트 한계를 넘으면 중간에 한 번 더 깸) */
+static void alarm_at(uint32_t tick) {
+    uint32_t delta = epoch + tick * TICK_CYCLES - dwt_cycles();
+    
+    if ((int32_t)delta < ALARM_MIN_CYCLES) delta = ALARM_MIN_CYCLES;
+    if (delta > SYST_MAX) delta = SYST_MAX;
+    
+    SYST_CSR = 0;
+    SYST_RVR = delta - 1;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_CLKSOURCE | SYST_CSR_TICKINT | SYST_CSR_ENABLE;
+}
+
+static void alarm_next(uint32_t now) {
+    uint32_t next = wheel_next(&idle_wheel);
+    uint32_t target = next == WHEEL_NONE ? end_tick : now + next;
+    
+    if ((int32_t)(target - end_tick) > 0) target = end_tick;
+    alarm_at(target);
+}
+
+static void alarm_stop(void) {
+    SYST_CSR = 0;
+    SCB_ICSR = 1u << 25;    /* PENDSTCLR */
+}
+
+// ========== SLEEPONEXIT: 핸들러 안에서 처리 ==========
+
+static void service_from_isr(void) {
+    uint32_t entry = dwt_cycles();
+    
+    report->asleep += entry - last_exit;
+    report->wakeups++;
+    
+    uint32_t now = idle_now();
+    wheel_advance(&idle_wheel, now);
+    if ((int32_t)(now - end_tick) >= 0) {
+        alarm_stop();
+        SCB_SCR &= ~SCR_SLEEPONEXIT;    /* 이번 예외 복귀는 스레드로 */
+        done = 1;
+    } else {
+        alarm_next(now);
+    }
+    last_exit = dwt_cycles();
+}
+
+void SysTick_Handler(void) {
+    report->alarms++;
+    if (mode != IDLE_TICKED) {
+        SYST_CSR = 0;       /* 한 번짜리 알람 */
+    }
+    if (mode == IDLE_SLEEPONEXIT && !done) {
+        service_from_isr();
+    }
+}
+
+void TIMER0_Handler(void) {
+    TIMER0_INTCLEAR = 1;
+    report->externals++;
+    if (mode == IDLE_SLEEPONEXIT && !done) {
+        service_from_isr();
+    }
+}
+
+// ========== 시작 / 실행 ==========
+
+static const char *const mode_names[IDLE_MODES] = {
+    "ticked, WFI",
+    "tickless, WFI",
+    "tickless, WFE+SEVONPEND",
+    "SLEEPONEXIT",
+};
+
+void idle_start(idle_mode_t m, idle_report_t *r, uint32_t external_period) {
+    mode = m;
+    report = r;
+    report->name = mode_names[m];
+    report->total = report->asleep = report->wakeups = 0;
+    report->alarms = report->externals = report->fired = 0;
+    report->late_sum = report->late_max = 0;
+    done = 0;
+    
+    epoch = dwt_cycles();
+    wheel_init(&idle_wheel, 0);
+    
+    TIMER0_CTRL = 0;
+    TIMER0_INTCLEAR = 1;
+    NVIC_ICPR0 = 1u << TIMER0_IRQn;
+    if (external_period) {
+        TIMER0_RELOAD = external_period;
+        TIMER0_VALUE = external_period;
+        NVIC_ISER0 = 1u << TIMER0_IRQn;
+        TIMER0_CTRL = TIMER_CTRL_EN | TIMER_CTRL_IRQEN;
+    }
+}
+
+/* 스레드 모드 잠: PRIMASK 안에서 다시 확인한 뒤 잠들고 깨어난 시간 기록 */
+static void sleep_thread(uint32_t now) {
+    uint32_t t0, t1;
+    
+    __asm volatile ("cpsid i" : : : "memory");
+    if (idle_now() != now) {                /* 그 사이 tick 이 지남 */
+        __asm volatile ("cpsie i" : : : "memory");
+        return;
+    }
+    if (mode != IDLE_TICKED) {
+        alarm_next(now);
+    }
+    
+    t0 = dwt_cycles();
+    if (mode == IDLE_TICKLESS_WFE) {
+        /* 이벤트 레지스터가 이미 1 이면 바로 돌아오므로 pending 이 생길 때까지 반복 */
+        do {
+            __asm volatile ("dsb\n\twfe" : : : "memory");
+            report->wakeups++;
+        } while (!(SCB_ICSR & (ICSR_ISRPENDING | ICSR_PENDSTSET)));
+    } else {
+        __asm volatile ("dsb\n\twfi" : : : "memory");
+        report->wakeups++;
+    }
+    t1 = dwt_cycles();
+    report->asleep += t1 - t0;
+    
+    __asm volatile ("cpsie i\n\tisb" : : : "memory");
+}
+
+void idle_run(uint32_t duration) {
+    uint32_t start = dwt_cycles();
+    
+    end_tick = duration;
+    
+    if (mode == IDLE_SLEEPONEXIT) {
+        __asm volatile ("cpsid i" : : : "memory");
+        alarm_next(idle_now());
+        last_exit = dwt_cycles();
+        SCB_SCR |= SCR_SLEEPONEXIT;
+        __asm volatile ("cpsie i" : : : "memory");
+        while (!done) {
+            __asm volatile ("dsb\n\twfi" : : : "memory");
+        }
+    } else {
+        if (mode == IDLE_TICKED) {
+            alarm_periodic();
+        }
+        if (mode == IDLE_TICKLESS_WFE) {
+            SCB_SCR |= SCR_SEVONPEND;
+        }
+        while (1) {
+            uint32_t now = idle_now();
+            wheel_advance(&idle_wheel, now);
+            if ((int32_t)(now - end_tick) >= 0) break;
+            sleep_thread(now);
+        }
+        SCB_SCR &= ~SCR_SEVONPEND;
+        alarm_stop();
+    }
+    
+    TIMER0_CTRL = 0;
+    NVIC_ICER0 = 1u << TIMER0_IRQn;
+    report->total = dwt_cycles() - start;
+}
@@ -0,0 +1,80 @@
+/*
+ * 이벤트 구동 idle 루프 - tick 기반 / tickless, WFI / WFE / SLEEPONEXIT
+ *
+ * 시간 기준은 자유 실행 사이클 카운터(dwt_cycles)이고, tick = TICK_CYCLES 사이클입니다.
+ * SysTick 은 "다음에 깰 시각" 알람으로만 씁니다. 그래서 tickless 로 오래 자고 일어나도
+ * tick 수를 세는 인터럽트를 놓쳐 시계가 밀리는 일이 없습니다.
+ */
+
+#ifndef IDLE_H
+#define IDLE_H
+
+#include <stdint.h>
+#include "wheel.h"
+
+#define TICK_CYCLES         25000   /* 1ms (25MHz) */
+#define ALARM_MIN_CYCLES    64      /* 이보다 가까운 알람은 이 값으로 */
+
+#define SCB_ICSR            (*(volatile uint32_t *)0xE000ED04)
+#define ICSR_ISRPENDING     (1u << 22)  /* NVIC 인터럽트 pending */
+#define ICSR_PENDSTSET      (1u << 26)  /* SysTick pending */
+#define SCB_SCR             (*(volatile uint32_t *)0xE000ED10)
+#define SCR_SLEEPONEXIT     (1u << 1)   /* 핸들러에서 스레드로 돌아가지 않고 바로 잠 */
+#define SCR_SLEEPDEEP       (1u << 2)
+#define SCR_SEVONPEND       (1u << 4)   /* pending 이 되는 인터럽트가 WFE 를 깨움 (마스크돼 있어도) */
+
+#define SYST_CSR            (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR            (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR            (*(volatile uint32_t *)0xE000E018)
+#define SYST_CSR_ENABLE     (1u << 0)
+#define SYST_CSR_TICKINT    (1u << 1)
+#define SYST_CSR_CLKSOURCE  (1u << 2)
+#define SYST_MAX            0x00FFFFFFu
+
+#define NVIC_ISER0          (*(volatile uint32_t *)0xE000E100)
+#define NVIC_ICER0          (*(volatile uint32_t *)0xE000E180)
+#define NVIC_ICPR0          (*(volatile uint32_t *)0xE000E280)
+
+/* CMSDK Timer0 - 외부 이벤트(버튼, UART 수신 등) 흉내 */
+#define TIMER0_CTRL         (*(volatile uint32_t *)0x50000000)
+#define TIMER0_RELOAD       (*(volatile uint32_t *)0x50000008)
+#define TIMER0_VALUE        (*(volatile uint32_t *)0x50000004)
+#define TIMER0_INTCLEAR     (*(volatile uint32_t *)0x5000000C)
+#define TIMER_CTRL_EN       (1u << 0)
+#define TIMER_CTRL_IRQEN    (1u << 3)
+#define TIMER0_IRQn         3
+
+typedef enum {
+    IDLE_TICKED,            /* 매 tick SysTick + WFI */
+    IDLE_TICKLESS_WFI,      /* 다음 이벤트 시각에 알람 + WFI */
+    IDLE_TICKLESS_WFE,      /* 같은 알람 + SEVONPEND + WFE */
+    IDLE_SLEEPONEXIT,       /* 모든 처리를 핸들러에서, 스레드는 WFI 한 번 */
+    IDLE_MODES
+} idle_mode_t;
+
+typedef struct {
+    const char *name;
+    uint32_t total;         /* 실행 구간 사이클 */
+    uint32_t asleep;        /* WFI/WFE 안에서 보낸 사이클 */
+    uint32_t wakeups;       /* 잠에서 돌아온 횟수 (WFE 는 가짜 깨어남 포함) */
+    uint32_t alarms;        /* SysTick */
+    uint32_t externals;     /* Timer0 */
+    uint32_t fired;         /* 휠 이벤트 */
+    uint32_t late_sum;      /* 만료 시각 -> 콜백 (사이클) */
+    uint32_t late_max;
+} idle_report_t;
+
+extern wheel_t idle_wheel;
+
+/* 기준 시각(epoch)과 휠 초기화. 이후 wheel_add(&idle_wheel, ...) 로 이벤트 등록 */
+void idle_start(idle_mode_t mode, idle_report_t *report, uint32_t external_period);
+
+/* duration tick 이 지날 때까지 이벤트 처리 + 잠 */
+void idle_run(uint32_t duration);
+
+uint32_t idle_now(void);
+
+/* 이벤트 콜백에서 호출: 만료 시각 대비 늦음 기록 */
+void idle_note_fired(const event_t *e);
+
+#endif /* IDLE_H */
@@ -0,0 +1,143 @@
+/*
+ * Cortex-M33 저전력 idle 실습 예제
+ * 이벤트 휠 + tickless 알람, WFI / WFE / SLEEPONEXIT, 잠든 시간 대 깨어 있는 시간
+ */
+
+#include <stdint.h>
+#include "idle.h"
+#include "report.h"
+#include "dwt.h"
+
+#define DURATION        500         /* tick (= 500ms) */
+#define EXTERNAL_PERIOD 83333       /* Timer0 주기 (약 3.3ms, tick 과 어긋나게) */
+
+// ========== 애플리케이션 이벤트 ==========
+
+typedef struct {
+    event_t ev;             /* 첫 멤버: 콜백에서 app_event_t 로 변환 */
+    uint32_t delay;         /* 첫 만료 */
+    uint32_t count;
+} app_event_t;
+
+static void on_event(event_t *e) {
+    app_event_t *app = (app_event_t *)e;
+    
+    app->count++;
+    idle_note_fired(e);
+}
+
+static app_event_t app_events[] = {
+    { { 0, 0,  10, on_event, "sensor"  },  10, 0 },
+    { { 0, 0, 100, on_event, "blink"   }, 100, 0 },
+    { { 0, 0, 250, on_event, "report"  }, 250, 0 },
+    { { 0, 0,   0, on_event, "oneshot" }, 333, 0 },
+};
+
+#define APP_EVENTS ((int)(sizeof(app_events) / sizeof(app_events[0])))
+
+/* DURATION 동안 기대 발화 수: sensor 50, blink 5, report 2, oneshot 1 */
+static uint32_t expected_count(const app_event_t *app) {
+    if (app->ev.period == 0) return app->delay <= DURATION;
+    return app->delay <= DURATION ? (DURATION - app->delay) / app->ev.period + 1 : 0;
+}
+
+static idle_report_t reports[IDLE_MODES];
+static int counts_ok[IDLE_MODES];
+
+static void run_mode(idle_mode_t mode) {
+    idle_start(mode, &reports[mode], EXTERNAL_PERIOD);
+    for (int i = 0; i < APP_EVENTS; i++) {
+        app_events[i].count = 0;
+        wheel_add(&idle_wheel, &app_events[i].ev, app_events[i].delay);
+    }
+    
+    idle_run(DURATION);
+    
+    counts_ok[mode] = 1;
+    for (int i = 0; i < APP_EVENTS; i++) {
+        if (app_events[i].count != expected_count(&app_events[i])) counts_ok[mode] = 0;
+    }
+}
+
+/* 천분율을 xx.x 로 */
+static void print_permille(uint32_t value, int width) {
+    print_number(value / 10, width - 2);
+    print_string(".");
+    print_number(value % 10, 0);
+}
+
+static void print_report(const idle_report_t *r) {
+    uint32_t permille = r->asleep / ((r->total + 999) / 1000);
+    
+    print_padded(r->name, 26);
+    print_number(r->wakeups, 8);
+    print_number(r->alarms, 7);
+    print_number(r->externals, 6);
+    print_permille(permille, 8);
+    print_number(r->total - r->asleep, 10);
+    print_number(r->fired ? r->late_sum / r->fired : 0, 9);
+    print_number(r->late_max, 9);
+    print_string("\n");
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 저전력 idle: 이벤트 휠 + tickless ===\n");
+    print_string("tick = 25000 cycles, 구간 500 tick, Timer0 외부 이벤트 83333 cycles 주기\n");
+    
+    dwt_init();
+    
+    for (int m = 0; m < IDLE_MODES; m++) {
+        run_mode((idle_mode_t)m);
+    }
+    
+    asm volatile ("nop"); // Breakpoint 1: 모든 모드 종료 (reports)
+    print_string("\n");
+    print_padded("mode", 26);
+    print_string(" wakeups alarms   ext asleep%  awake cyc late avg late max\n");
+    print_string("------------------------------------------------------------------------------------\n");
+    for (int m = 0; m < IDLE_MODES; m++) {
+        print_report(&reports[m]);
+    }
+    
+    print_string("\n이벤트     주기  기대 발화\n");
+    for (int i = 0; i < APP_EVENTS; i++) {
+        print_padded(app_events[i].ev.name, 8);
+        print_number(app_events[i].ev.period, 6);
+        print_number(expected_count(&app_events[i]), 11);
+        print_string("\n");
+    }
+    
+    const idle_report_t *ticked = &reports[IDLE_TICKED];
+    const idle_report_t *tickless = &reports[IDLE_TICKLESS_WFI];
+    const idle_report_t *wfe = &reports[IDLE_TICKLESS_WFE];
+    const idle_report_t *on_exit = &reports[IDLE_SLEEPONEXIT];
+    uint32_t ext_expected = DURATION * TICK_CYCLES / EXTERNAL_PERIOD;
+    int ext_ok = 1;
+    int late_ok = 1;
+    
+    for (int m = 0; m < IDLE_MODES; m++) {
+        uint32_t ext = reports[m].externals;
+        if (ext + 2 < ext_expected || ext > ext_expected + 2) ext_ok = 0;
+        if (reports[m].late_max >= TICK_CYCLES) late_ok = 0;
+    }
+    
+    print_string("\n결과 검증:\n");
+    check("모든 모드에서 이벤트 발화 수 일치",
+          counts_ok[IDLE_TICKED] && counts_ok[IDLE_TICKLESS_WFI] &&
+          counts_ok[IDLE_TICKLESS_WFE] && counts_ok[IDLE_SLEEPONEXIT]);
+    check("Timer0 외부 이벤트 수 (150 +/- 2)", ext_ok);
+    check("tickless 는 tick 마다 깨지 않음 (깨어남 절반 미만)", tickless->wakeups * 2 < ticked->wakeups);
+    check("tickless 가 더 오래 잠", tickless->asleep >= ticked->asleep);
+    check("WFE 깨어남 >= WFI 깨어남 (가짜 깨어남 포함)", wfe->wakeups >= tickless->wakeups);
+    check("SLEEPONEXIT: 핸들러에서 처리 후 스레드 복귀", on_exit->wakeups > 0 && on_exit->asleep > 0);
+    check("만료 -> 콜백 늦음 < 1 tick", late_ok);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
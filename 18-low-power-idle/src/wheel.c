@@ -0,0 +1,87 @@
+/*
+ * 해시 타이머 휠
+ *
+ * advance 는 지나간 tick 의 슬롯만 봅니다 (한 바퀴 이상 잤으면 모든 슬롯 한 번).
+ * 콜백은 슬롯 순회가 끝난 뒤 호출하므로 콜백 안에서 wheel_add 를 해도 안전합니다.
+ */
+
+#include "wheel.h"
+
+static void slot_insert(wheel_t *w, event_t *e) {
+    event_t **slot = &w->slots[e->expires & WHEEL_MASK];
+    
+    e->next = *slot;
+    *slot = e;
+    w->pending++;
+}
+
+void wheel_init(wheel_t *w, uint32_t now) {
+    for (int i = 0; i < WHEEL_SLOTS; i++) {
+        w->slots[i] = 0;
+    }
+    w->now = now;
+    w->pending = 0;
+}
+
+void wheel_add(wheel_t *w, event_t *e, uint32_t delay) {
+    e->expires = w->now + (delay ? delay : 1);
+    slot_insert(w, e);
+}
+
+uint32_t wheel_advance(wheel_t *w, uint32_t now) {
+    uint32_t steps = now - w->now;
+    uint32_t from = w->now + 1;
+    event_t *due = 0;
+    event_t **tail = &due;
+    uint32_t fired = 0;
+    
+    if (steps == 0) return 0;
+    if (steps > WHEEL_SLOTS) steps = WHEEL_SLOTS;
+    w->now = now;
+    
+    for (uint32_t k = 0; k < steps; k++) {
+        event_t **pp = &w->slots[(from + k) & WHEEL_MASK];
+        
+        while (*pp) {
+            event_t *e = *pp;
+            if ((int32_t)(e->expires - now) <= 0) {
+                *pp = e->next;
+                w->pending--;
+                e->next = 0;
+                *tail = e;
+                tail = &e->next;
+            } else {
+                pp = &e->next;
+            }
+        }
+    }
+    
+    while (due) {
+        event_t *e = due;
+        due = e->next;
+        e->fn(e);               /* e->expires = 만료 tick (늦음 계산용) */
+        fired++;
+        if (e->period) {
+            do {
+                e->expires += e->period;
+            } while ((int32_t)(e->expires - now) <= 0);
+            slot_insert(w, e);
+        }
+    }
+    return fired;
+}
+
+uint32_t wheel_next(const wheel_t *w) {
+    uint32_t best = WHEEL_NONE;
+    
+    /* now+1 슬롯부터: k 번째 슬롯에서 k tick 뒤 이벤트를 찾으면 뒤 슬롯은 볼 필요 없음 */
+    for (uint32_t k = 1; k <= WHEEL_SLOTS; k++) {
+        for (const event_t *e = w->slots[(w->now + k) & WHEEL_MASK]; e; e = e->next) {
+            int32_t delta = (int32_t)(e->expires - w->now);
+            if (delta <= 0) return 0;
+            if ((uint32_t)delta < best) best = delta;
+        }
+        if (best <= k) break;
+    }
+    return best;
+}
@@ -0,0 +1,43 @@
+/*
+ * 해시 타이머 휠 - 대기 중인 이벤트를 만료 tick 의 하위 비트로 슬롯에 나눠 둠
+ *
+ * 슬롯 = expires & (WHEEL_SLOTS - 1). 한 바퀴(32 tick)보다 먼 이벤트도 같은 슬롯에 있다가
+ * 만료 tick 이 되어야 발화합니다. 노드는 이벤트 구조체 안에 있으므로(intrusive) 할당이 없습니다.
+ */
+
+#ifndef WHEEL_H
+#define WHEEL_H
+
+#include <stdint.h>
+
+#define WHEEL_SLOTS     32
+#define WHEEL_MASK      (WHEEL_SLOTS - 1)
+#define WHEEL_NONE      0xFFFFFFFFu     /* 대기 중인 이벤트 없음 */
+
+typedef struct event event_t;
+typedef void (*event_fn_t)(event_t *e);
+
+struct event {
+    event_t *next;
+    uint32_t expires;       /* 절대 tick */
+    uint32_t period;        /* 0 = 한 번 */
+    event_fn_t fn;
+    const char *name;
+};
+
+typedef struct {
+    event_t *slots[WHEEL_SLOTS];
+    uint32_t now;           /* 마지막으로 처리한 tick */
+    uint32_t pending;
+} wheel_t;
+
+void wheel_init(wheel_t *w, uint32_t now);
+void wheel_add(wheel_t *w, event_t *e, uint32_t delay);
+
+/* now 까지 만료된 이벤트 발화 (주기 이벤트는 콜백 뒤 다시 등록). 발화 수 */
+uint32_t wheel_advance(wheel_t *w, uint32_t now);
+
+/* 다음 만료까지 남은 tick (0 = 이미 만료, WHEEL_NONE = 없음) */
+uint32_t wheel_next(const wheel_t *w);
+
+#endif /* WHEEL_H */
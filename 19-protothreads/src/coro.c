@@ -0,0 +1,91 @@
+/*
+ * 비교용 스택 코루틴
+ */
+
+#include <stddef.h>
+#include "coro.h"
+
+#define FRAME_WORDS 10              /* r3-r11, lr */
+
+static coro_t *current;
+static uint32_t runner_sp;          /* coro_run 의 SP (실행기 문맥) */
+
+void coro_entry(coro_t *c);
+
+void coro_init(coro_t **list, coro_t *c, coro_fn_t fn, uint32_t *stack, uint32_t words) {
+    for (uint32_t i = 0; i < words; i++) {
+        stack[i] = CORO_STACK_PAINT;
+    }
+    
+    uint32_t *top = stack + (words & ~1u);      /* 8바이트 정렬 */
+    uint32_t *frame = top - FRAME_WORDS;
+    for (int i = 0; i < FRAME_WORDS; i++) {
+        frame[i] = 0;
+    }
+    frame[1] = (uint32_t)c;                     /* r4 */
+    frame[9] = (uint32_t)coro_trampoline;       /* lr -> pc (Thumb 비트 포함) */
+    
+    c->sp = (uint32_t)frame;
+    c->fn = fn;
+    c->stack = stack;
+    c->stack_words = words;
+    c->done = 0;
+    c->resumes = 0;
+    
+    if (*list == NULL) {
+        c->next = c;
+        *list = c;
+        return;
+    }
+    coro_t *tail = *list;
+    while (tail->next != *list) {
+        tail = tail->next;
+    }
+    tail->next = c;
+    c->next = *list;
+}
+
+/* coro_trampoline 에서 호출: fn 이 반환하면 끝난 것으로 표시하고 다시 돌아오지 않음 */
+void coro_entry(coro_t *c) {
+    c->fn(c);
+    c->done = 1;
+    while (1) {
+        coro_yield();
+    }
+}
+
+void coro_yield(void) {
+    coro_switch(&current->sp, runner_sp);
+}
+
+uint32_t coro_run(coro_t *list) {
+    uint32_t resumes = 0;
+    int alive = 1;
+    
+    while (alive) {
+        alive = 0;
+        coro_t *c = list;
+        do {
+            if (!c->done) {
+                current = c;
+                c->resumes++;
+                resumes++;
+                coro_switch(&runner_sp, c->sp);
+                if (!c->done) alive = 1;
+            }
+            c = c->next;
+        } while (c != list);
+    }
+    current = NULL;
+    return resumes;
+}
+
+uint32_t coro_stack_used(const coro_t *c) {
+    const uint32_t *p = c->stack;
+    const uint32_t *end = c->stack + c->stack_words;
+    
+    while (p < end && *p == CORO_STACK_PAINT) {
+        p++;
+    }
+    return (uint32_t)(end - p) * 4;
+}
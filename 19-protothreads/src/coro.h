@@ -0,0 +1,47 @@
+/*
+ * 비교용 스택 코루틴 (태스크마다 스택, 협력형 라운드 로빈)
+ *
+ * 13-scheduler 와 같은 "태스크마다 스택" 설계에서 선점(PendSV, SysTick)만 뺀 것입니다.
+ * 같은 작업을 프로토스레드와 이것으로 각각 돌려 RAM 과 전환 비용을 비교합니다.
+ *
+ *   coro_yield():  태스크 -> 실행기 (coro_switch)
+ *   coro_run():    실행기 -> 다음 태스크 (coro_switch)
+ */
+
+#ifndef CORO_H
+#define CORO_H
+
+#include <stdint.h>
+
+#define CORO_STACK_PAINT    0xDEADBEEFu
+
+typedef struct coro coro_t;
+typedef void (*coro_fn_t)(coro_t *self);
+
+struct coro {
+    uint32_t sp;            /* 저장된 SP (coro_switch 가 갱신) */
+    coro_fn_t fn;
+    coro_t *next;           /* 원형 목록 */
+    uint32_t *stack;        /* 스택 바닥 */
+    uint32_t stack_words;
+    int done;
+    uint32_t resumes;
+};
+
+/* 스택을 칠하고 첫 진입 프레임을 만든 뒤 목록(list 가 가리키는 원형 목록)에 추가 */
+void coro_init(coro_t **list, coro_t *c, coro_fn_t fn, uint32_t *stack, uint32_t words);
+
+/* 현재 태스크 -> 실행기 (태스크 안에서만 호출) */
+void coro_yield(void);
+
+/* 모든 태스크가 끝날 때까지 라운드 로빈, 전체 재개 횟수 반환 */
+uint32_t coro_run(coro_t *list);
+
+/* 칠이 지워진 스택 바이트 (최대 사용량) */
+uint32_t coro_stack_used(const coro_t *c);
+
+/* coro_switch.s */
+void coro_switch(uint32_t *save_sp, uint32_t next_sp);
+void coro_trampoline(void);
+
+#endif /* CORO_H */
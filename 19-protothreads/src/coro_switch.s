@@ -0,0 +1,37 @@
+/*
+ * 스택 코루틴 문맥 전환 (협력형, 함수 호출 안에서)
+ *
+ *   void coro_switch(uint32_t *save_sp, uint32_t next_sp);
+ *
+ * 호출 규약상 호출자가 보존하는 r0-r3, r12 는 저장할 필요가 없습니다.
+ * 보존 레지스터 r4-r11 과 복귀 주소만 현재 스택에 쌓고, SP 를 바꾼 뒤 새 스택에서 꺼냅니다.
+ *
+ *   [저장된 SP] r3 r4 r5 r6 r7 r8 r9 r10 r11 lr     (r3 은 8바이트 정렬용)
+ *
+ * 새 코루틴의 첫 프레임은 coro_init 이 만듭니다: r4 = coro_t *, lr = coro_trampoline
+ */
+
+    .syntax unified
+    .thumb
+    .text
+
+    .thumb_func
+    .global coro_switch
+    .type coro_switch, %function
+coro_switch:
+    push    {r3-r11, lr}
+    mov     r2, sp
+    str     r2, [r0]                /* *save_sp = 현재 SP */
+    mov     sp, r1
+    pop     {r3-r11, pc}
+    .size coro_switch, .-coro_switch
+
+/* 첫 진입: coro_switch 의 pop 이 여기로 복귀, r4 = coro_t * */
+    .thumb_func
+    .global coro_trampoline
+    .type coro_trampoline, %function
+coro_trampoline:
+    mov     r0, r4
+    bl      coro_entry              /* 돌아오지 않음 */
+    b       .
+    .size coro_trampoline, .-coro_trampoline
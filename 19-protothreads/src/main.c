@@ -0,0 +1,517 @@
+/*
+ * Cortex-M33 프로토스레드 실습 예제
+ * 스택 없는 상태 기계 여러 개가 스택 하나를 공유, 태스크마다 스택을 두는 설계와 RAM / 전환 비용 비교
+ */
+
+#include <stdint.h>
+#include "pt_exec.h"
+#include "coro.h"
+#include "report.h"
+#include "dwt.h"
+
+#define WORKERS             8
+#define STEPS               32
+#define CORO_STACK_WORDS    128         /* 512B, 13-scheduler 태스크 스택과 같은 크기 */
+#define PINGPONG            1000        /* 태스크당 양보 횟수 */
+#define ITEMS               20
+#define QUEUE_SIZE          4
+#define SHARED_PAINT_WORDS  256         /* 공유 스택 측정용으로 칠할 1KB */
+#define REPEAT              5
+
+#define NAME_WIDTH 30
+
+static int str_equal(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+// ========== 공유 스택 최대 사용량 ==========
+
+static uint32_t *shared_low;
+
+static inline uint32_t current_sp(void) {
+    uint32_t sp;
+    asm volatile ("mov %0, sp" : "=r"(sp));
+    return sp;
+}
+
+/* 이 함수의 프레임 아래(아직 아무도 쓰지 않은 곳)를 칠함 */
+__attribute__((noinline)) static void shared_stack_paint(void) {
+    uint32_t *p = (uint32_t *)(current_sp() & ~7u);
+    
+    shared_low = p - SHARED_PAINT_WORDS;
+    while (p > shared_low) {
+        *--p = CORO_STACK_PAINT;
+    }
+}
+
+/* sp_ref (측정 대상 호출 직전의 SP) 아래로 쓰인 바이트 */
+static uint32_t shared_stack_used(uint32_t sp_ref) {
+    const uint32_t *p = shared_low;
+    
+    while (p < (const uint32_t *)sp_ref && *p == CORO_STACK_PAINT) {
+        p++;
+    }
+    return sp_ref - (uint32_t)p;
+}
+
+// ========== 공통 작업 ==========
+
+/* 한 단계 작업: 지역 배열을 써서 스택 프레임이 생기게 함 */
+__attribute__((noinline)) static uint32_t work_step(uint32_t seed) {
+    volatile uint32_t mix[8];
+    uint32_t sum = 0;
+    
+    for (int i = 0; i < 8; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        mix[i] = seed;
+    }
+    for (int i = 0; i < 8; i++) {
+        sum += mix[i];
+    }
+    return sum ^ seed;
+}
+
+static uint32_t worker_seed(int i) {
+    return 0x9E3779B9u * (uint32_t)(i + 1);
+}
+
+// ========== 데모 1: 라운드 로빈 순서 ==========
+
+static char trace[32];
+static int trace_len;
+
+typedef struct {
+    pt_task_t task;
+    char letter;
+    uint32_t count;
+    uint32_t i;
+} letter_pt_t;
+
+static char letter_thread(pt_task_t *t) {
+    letter_pt_t *l = (letter_pt_t *)t;
+    
+    PT_BEGIN(&t->pt);
+    for (l->i = 0; l->i < l->count; l->i++) {
+        trace[trace_len++] = l->letter;
+        PT_YIELD(&t->pt);
+    }
+    PT_END(&t->pt);
+}
+
+typedef struct {
+    coro_t coro;
+    char letter;
+    uint32_t count;
+} letter_coro_t;
+
+static void letter_coro(coro_t *self) {
+    letter_coro_t *l = (letter_coro_t *)self;
+    
+    for (uint32_t i = 0; i < l->count; i++) {
+        trace[trace_len++] = l->letter;
+        coro_yield();
+    }
+}
+
+/* A 3번, B 5번, C 2번 */
+static const char expected_trace[] = "ABCABCABBB";
+
+static char pt_trace[32];
+static char coro_trace[32];
+static uint32_t coro_letter_stacks[3][CORO_STACK_WORDS];
+
+static void copy_trace(char *dst) {
+    for (int i = 0; i < trace_len; i++) {
+        dst[i] = trace[i];
+    }
+    dst[trace_len] = '\0';
+    trace_len = 0;
+}
+
+static void demo_trace(void) {
+    static letter_pt_t pts[3] = { { .letter = 'A', .count = 3 }, { .letter = 'B', .count = 5 },
+                                  { .letter = 'C', .count = 2 } };
+    static letter_coro_t coros[3] = { { .letter = 'A', .count = 3 }, { .letter = 'B', .count = 5 },
+                                      { .letter = 'C', .count = 2 } };
+    pt_exec_t x;
+    coro_t *list = 0;
+    
+    pt_exec_init(&x);
+    for (int i = 0; i < 3; i++) {
+        pt_exec_add(&x, &pts[i].task, letter_thread, "letter");
+    }
+    pt_exec_run(&x);
+    copy_trace(pt_trace);
+    
+    for (int i = 0; i < 3; i++) {
+        coro_init(&list, &coros[i].coro, letter_coro, coro_letter_stacks[i], CORO_STACK_WORDS);
+    }
+    coro_run(list);
+    copy_trace(coro_trace);
+}
+
+// ========== 데모 2: 생산자 / 소비자 (PT_WAIT_UNTIL) ==========
+
+static uint32_t queue[QUEUE_SIZE];
+static uint32_t queue_head, queue_tail;    /* 자유 증가 인덱스 */
+
+static uint32_t produced, consumed, consumed_sum, producer_waits;
+static int order_ok = 1;
+
+static char producer_thread(pt_task_t *t) {
+    PT_BEGIN(&t->pt);
+    while (produced < ITEMS) {
+        if (queue_head - queue_tail == QUEUE_SIZE) producer_waits++;
+        PT_WAIT_UNTIL(&t->pt, queue_head - queue_tail < QUEUE_SIZE);
+        queue[queue_head++ % QUEUE_SIZE] = ++produced;
+        /* 한 번에 두 개씩 넣고 양보 -> 큐가 차는 경우가 생김 */
+        if (produced % 2 == 0) PT_YIELD(&t->pt);
+    }
+    PT_END(&t->pt);
+}
+
+static char consumer_thread(pt_task_t *t) {
+    PT_BEGIN(&t->pt);
+    while (consumed < ITEMS) {
+        PT_WAIT_UNTIL(&t->pt, queue_head != queue_tail);
+        uint32_t item = queue[queue_tail++ % QUEUE_SIZE];
+        if (item != consumed + 1) order_ok = 0;
+        consumed++;
+        consumed_sum += item;
+        PT_YIELD(&t->pt);
+    }
+    PT_END(&t->pt);
+}
+
+static uint32_t pc_resumes;
+
+static void demo_producer_consumer(void) {
+    static pt_task_t producer, consumer;
+    pt_exec_t x;
+    
+    pt_exec_init(&x);
+    pt_exec_add(&x, &producer, producer_thread, "producer");
+    pt_exec_add(&x, &consumer, consumer_thread, "consumer");
+    pc_resumes = pt_exec_run(&x);
+}
+
+// ========== 데모 3: 자식 프로토스레드 (PT_SPAWN) ==========
+
+typedef struct {
+    pt_t pt;
+    uint32_t value;
+    uint32_t i;
+} square_pt_t;
+
+/* value^16: 제곱 한 번마다 양보 */
+static char square4_thread(square_pt_t *s) {
+    PT_BEGIN(&s->pt);
+    for (s->i = 0; s->i < 4; s->i++) {
+        s->value *= s->value;
+        PT_YIELD(&s->pt);
+    }
+    PT_END(&s->pt);
+}
+
+typedef struct {
+    pt_task_t task;
+    square_pt_t child;
+    uint32_t base;
+    uint32_t result;
+} power_pt_t;
+
+static char power_thread(pt_task_t *t) {
+    power_pt_t *p = (power_pt_t *)t;
+    
+    PT_BEGIN(&t->pt);
+    p->child.value = p->base;
+    PT_SPAWN(&t->pt, &p->child.pt, square4_thread(&p->child));
+    p->result = p->child.value;
+    PT_END(&t->pt);
+}
+
+static power_pt_t powers[2] = { { .base = 2 }, { .base = 3 } };
+
+static void demo_spawn(void) {
+    pt_exec_t x;
+    
+    pt_exec_init(&x);
+    pt_exec_add(&x, &powers[0].task, power_thread, "pow2");
+    pt_exec_add(&x, &powers[1].task, power_thread, "pow3");
+    pt_exec_run(&x);
+}
+
+// ========== 벤치마크 1: 작업 태스크 8개 (RAM, 전체 시간) ==========
+
+typedef struct {
+    pt_task_t task;
+    uint32_t seed;
+    uint32_t step;
+} worker_pt_t;
+
+static char worker_thread(pt_task_t *t) {
+    worker_pt_t *w = (worker_pt_t *)t;
+    
+    PT_BEGIN(&t->pt);
+    for (w->step = 0; w->step < STEPS; w->step++) {
+        w->seed = work_step(w->seed);
+        PT_YIELD(&t->pt);
+    }
+    PT_END(&t->pt);
+}
+
+typedef struct {
+    coro_t coro;
+    uint32_t seed;
+} worker_coro_t;
+
+/* 지역 변수 i 는 태스크 스택에 살아 있음 (프로토스레드는 구조체에 둬야 함) */
+static void worker_coro(coro_t *self) {
+    worker_coro_t *w = (worker_coro_t *)self;
+    
+    for (uint32_t i = 0; i < STEPS; i++) {
+        w->seed = work_step(w->seed);
+        coro_yield();
+    }
+}
+
+static worker_pt_t worker_pts[WORKERS];
+static worker_coro_t worker_coros[WORKERS];
+static uint32_t worker_stacks[WORKERS][CORO_STACK_WORDS];
+static uint32_t seq_results[WORKERS];
+
+static stats_t seq_cycles, pt_cycles, coro_cycles;
+static uint32_t pt_worker_resumes, coro_worker_resumes;
+static uint32_t shared_peak, coro_peak;
+static int pt_results_ok, coro_results_ok;
+
+static void bench_workers(void) {
+    pt_exec_t x;
+    coro_t *list;
+    uint32_t start, sp_ref;
+    
+    for (int r = 0; r < REPEAT; r++) {
+        /* 기준: 지금까지의 모듈처럼 하나씩 순서대로 */
+        start = dwt_cycles();
+        for (int i = 0; i < WORKERS; i++) {
+            uint32_t seed = worker_seed(i);
+            for (int s = 0; s < STEPS; s++) {
+                seed = work_step(seed);
+            }
+            seq_results[i] = seed;
+        }
+        stats_add(&seq_cycles, dwt_elapsed(start));
+    
+        /* 프로토스레드: 공유 스택 */
+        pt_exec_init(&x);
+        for (int i = 0; i < WORKERS; i++) {
+            worker_pts[i].seed = worker_seed(i);
+            pt_exec_add(&x, &worker_pts[i].task, worker_thread, "worker");
+        }
+        shared_stack_paint();
+        sp_ref = current_sp();
+        start = dwt_cycles();
+        pt_worker_resumes = pt_exec_run(&x);
+        stats_add(&pt_cycles, dwt_elapsed(start));
+        shared_peak = shared_stack_used(sp_ref);
+    
+        /* 스택 코루틴: 태스크마다 512B */
+        list = 0;
+        for (int i = 0; i < WORKERS; i++) {
+            worker_coros[i].seed = worker_seed(i);
+            coro_init(&list, &worker_coros[i].coro, worker_coro, worker_stacks[i], CORO_STACK_WORDS);
+        }
+        start = dwt_cycles();
+        coro_worker_resumes = coro_run(list);
+        stats_add(&coro_cycles, dwt_elapsed(start));
+    }
+    
+    pt_results_ok = 1;
+    coro_results_ok = 1;
+    coro_peak = 0;
+    for (int i = 0; i < WORKERS; i++) {
+        if (worker_pts[i].seed != seq_results[i]) pt_results_ok = 0;
+        if (worker_coros[i].seed != seq_results[i]) coro_results_ok = 0;
+        uint32_t used = coro_stack_used(&worker_coros[i].coro);
+        if (used > coro_peak) coro_peak = used;
+    }
+}
+
+// ========== 벤치마크 2: 전환 비용 (핑퐁) ==========
+
+typedef struct {
+    pt_task_t task;
+    uint32_t count;
+} ping_pt_t;
+
+static char ping_thread(pt_task_t *t) {
+    ping_pt_t *p = (ping_pt_t *)t;
+    
+    PT_BEGIN(&t->pt);
+    while (p->count < PINGPONG) {
+        p->count++;
+        PT_YIELD(&t->pt);
+    }
+    PT_END(&t->pt);
+}
+
+typedef struct {
+    coro_t coro;
+    uint32_t count;
+} ping_coro_t;
+
+static void ping_coro(coro_t *self) {
+    ping_coro_t *p = (ping_coro_t *)self;
+    
+    while (p->count < PINGPONG) {
+        p->count++;
+        coro_yield();
+    }
+}
+
+/* 기준: 같은 일을 하는 평범한 함수 호출 */
+__attribute__((noinline)) static void ping_call(volatile uint32_t *count) {
+    (*count)++;
+}
+
+static ping_pt_t ping_pts[2];
+static ping_coro_t ping_coros[2];
+static uint32_t ping_stacks[2][CORO_STACK_WORDS];
+
+static stats_t call_switch, pt_switch, coro_switch_cost;
+static int ping_ok = 1;
+
+static void bench_pingpong(void) {
+    pt_exec_t x;
+    coro_t *list;
+    uint32_t start, resumes;
+    volatile uint32_t calls;
+    
+    for (int r = 0; r < REPEAT; r++) {
+        calls = 0;
+        start = dwt_cycles();
+        for (int i = 0; i < 2 * PINGPONG; i++) {
+            ping_call(&calls);
+        }
+        stats_add(&call_switch, dwt_elapsed(start) / (2 * PINGPONG));
+    
+        pt_exec_init(&x);
+        for (int i = 0; i < 2; i++) {
+            ping_pts[i].count = 0;
+            pt_exec_add(&x, &ping_pts[i].task, ping_thread, "ping");
+        }
+        start = dwt_cycles();
+        resumes = pt_exec_run(&x);
+        stats_add(&pt_switch, dwt_elapsed(start) / resumes);
+        if (resumes != 2 * (PINGPONG + 1)) ping_ok = 0;
+    
+        list = 0;
+        for (int i = 0; i < 2; i++) {
+            ping_coros[i].count = 0;
+            coro_init(&list, &ping_coros[i].coro, ping_coro, ping_stacks[i], CORO_STACK_WORDS);
+        }
+        start = dwt_cycles();
+        resumes = coro_run(list);
+        stats_add(&coro_switch_cost, dwt_elapsed(start) / resumes);
+        if (resumes != 2 * (PINGPONG + 1)) ping_ok = 0;
+    }
+}
+
+// ========== 출력 ==========
+
+static void print_ram_row(const char *name, uint32_t per_task, uint32_t stack_per_task,
+                          uint32_t shared, uint32_t total) {
+    print_padded(name, NAME_WIDTH);
+    print_number(per_task, 7);
+    print_number(stack_per_task, 11);
+    print_number(shared, 9);
+    print_number(total, 9);
+    print_string("\n");
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 프로토스레드: 스택 없는 코루틴 ===\n");
+    
+    dwt_init();
+    
+    demo_trace();
+    demo_producer_consumer();
+    demo_spawn();
+    
+    asm volatile ("nop"); // Breakpoint 1: 데모 종료 (pt_trace, queue, powers)
+    print_string("\n라운드 로빈 순서 (A x3, B x5, C x2)\n");
+    print_string("  protothread: ");
+    print_string(pt_trace);
+    print_string("\n  stackful:    ");
+    print_string(coro_trace);
+    print_string("\n\n생산자/소비자 (큐 4칸): ");
+    print_number(consumed, 0);
+    print_string("개, 합 ");
+    print_number(consumed_sum, 0);
+    print_string(", 큐가 차서 대기 ");
+    print_number(producer_waits, 0);
+    print_string("번, 재개 ");
+    print_number(pc_resumes, 0);
+    print_string("번\n");
+    print_string("PT_SPAWN: 2^16 = ");
+    print_number(powers[0].result, 0);
+    print_string(", 3^16 = ");
+    print_number(powers[1].result, 0);
+    print_string("\n");
+    
+    bench_workers();
+    bench_pingpong();
+    
+    asm volatile ("nop"); // Breakpoint 2: 벤치마크 종료 (shared_peak, coro_peak)
+    uint32_t pt_task_bytes = sizeof(worker_pt_t);
+    uint32_t coro_task_bytes = sizeof(worker_coro_t);
+    uint32_t pt_total = WORKERS * pt_task_bytes + shared_peak;
+    uint32_t coro_alloc_total = WORKERS * (coro_task_bytes + CORO_STACK_WORDS * 4);
+    uint32_t coro_hw_total = WORKERS * (coro_task_bytes + coro_peak);
+    
+    print_string("\nRAM, 작업 태스크 8개 (bytes)     task  stack/task   shared    total\n");
+    print_string("----------------------------------------------------------------------\n");
+    print_ram_row("protothread", pt_task_bytes, 0, shared_peak, pt_total);
+    print_ram_row("stackful, 512B stacks", coro_task_bytes, CORO_STACK_WORDS * 4, 0, coro_alloc_total);
+    print_ram_row("stackful, high-water", coro_task_bytes, coro_peak, 0, coro_hw_total);
+    
+    print_string("\ncycles                             min     avg     max  samples\n");
+    print_string("---------------------------------------------------------------\n");
+    print_stats("8 workers x 32, sequential", NAME_WIDTH, &seq_cycles);
+    print_stats("8 workers x 32, protothread", NAME_WIDTH, &pt_cycles);
+    print_stats("8 workers x 32, stackful", NAME_WIDTH, &coro_cycles);
+    print_stats("per switch, function call", NAME_WIDTH, &call_switch);
+    print_stats("per switch, protothread", NAME_WIDTH, &pt_switch);
+    print_stats("per switch, stackful", NAME_WIDTH, &coro_switch_cost);
+    
+    print_string("\n결과 검증:\n");
+    check("라운드 로빈 순서 (프로토스레드)", str_equal(pt_trace, expected_trace));
+    check("라운드 로빈 순서 (스택 코루틴과 같음)", str_equal(coro_trace, expected_trace));
+    check("생산자/소비자: 순서, 개수, 합",
+          order_ok && consumed == ITEMS && consumed_sum == ITEMS * (ITEMS + 1) / 2);
+    check("생산자가 큐가 차서 PT_WAIT_UNTIL 로 대기함", producer_waits > 0);
+    check("PT_SPAWN 자식 결과 (2^16, 3^16)", powers[0].result == 65536 && powers[1].result == 43046721);
+    check("작업 결과 = 순차 실행 (프로토스레드)", pt_results_ok);
+    check("작업 결과 = 순차 실행 (스택 코루틴)", coro_results_ok);
+    check("재개 횟수 = 8 x (32 + 1), 두 설계 같음",
+          pt_worker_resumes == WORKERS * (STEPS + 1) && coro_worker_resumes == pt_worker_resumes);
+    check("핑퐁 재개 횟수 = 2 x (1000 + 1)", ping_ok);
+    check("공유 스택 측정됨 (칠한 구역 안)", shared_peak > 0 && shared_peak < SHARED_PAINT_WORDS * 4);
+    check("태스크당 RAM: 프로토스레드 < 스택 코루틴 최소 스택", pt_task_bytes < coro_task_bytes + coro_peak);
+    check("8개 전체 RAM: 프로토스레드 < 스택 코루틴 (high-water)", pt_total < coro_hw_total);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
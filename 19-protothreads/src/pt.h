@@ -0,0 +1,77 @@
+/*
+ * 프로토스레드 (스택 없는 코루틴)
+ *
+ * 함수 하나를 switch 문으로 감싸고, 멈춘 줄 번호(__LINE__)를 lc 에 저장합니다.
+ * 다시 호출하면 switch 가 그 case 로 바로 점프합니다 (Duff's device).
+ *
+ *   static char worker(pt_task_t *t) {
+ *       PT_BEGIN(&t->pt);
+ *       while (...) {
+ *           PT_WAIT_UNTIL(&t->pt, ready);
+ *           ...
+ *           PT_YIELD(&t->pt);
+ *       }
+ *       PT_END(&t->pt);
+ *   }
+ *
+ * 주의:
+ *   - 지역 변수는 YIELD/WAIT 를 건너 살아남지 못함 -> 상태는 구조체에 둘 것
+ *   - PT_BEGIN 과 PT_END 사이에 다른 switch 문을 쓰면 case 가 섞임
+ *   - 한 줄에 PT_ 매크로 두 개 금지 (__LINE__ 이 같아짐)
+ */
+
+#ifndef PT_H
+#define PT_H
+
+#include <stdint.h>
+
+/* 반환값 */
+#define PT_WAITING  0       /* 조건을 기다리는 중 */
+#define PT_YIELDED  1       /* 양보, 다음 차례에 이어서 */
+#define PT_EXITED   2       /* PT_EXIT 으로 중간 종료 */
+#define PT_ENDED    3       /* PT_END 도달 */
+
+typedef struct {
+    uint16_t lc;            /* 재개할 줄 번호 (0 = 처음부터) */
+} pt_t;
+
+#define PT_INIT(pt)         ((pt)->lc = 0)
+
+#define PT_BEGIN(pt)        switch ((pt)->lc) { case 0:
+    
+#define PT_END(pt)          } (pt)->lc = 0; return PT_ENDED
+
+/* cond 가 참이 될 때까지 매 호출마다 여기서 반환 */
+#define PT_WAIT_UNTIL(pt, cond)                 \
+    do {                                        \
+        (pt)->lc = __LINE__; case __LINE__:     \
+        if (!(cond)) return PT_WAITING;         \
+    } while (0)
+
+#define PT_WAIT_WHILE(pt, cond)     PT_WAIT_UNTIL((pt), !(cond))
+
+/* 조건 없이 한 번 양보 */
+#define PT_YIELD(pt)                            \
+    do {                                        \
+        (pt)->lc = __LINE__;                    \
+        return PT_YIELDED;                      \
+        case __LINE__:;                         \
+    } while (0)
+
+#define PT_EXIT(pt)                             \
+    do {                                        \
+        PT_INIT(pt);                            \
+        return PT_EXITED;                       \
+    } while (0)
+
+/* 자식 프로토스레드가 끝날 때까지 대기 (thread 는 자식 호출식) */
+#define PT_SCHEDULE(f)              ((f) < PT_EXITED)
+#define PT_WAIT_THREAD(pt, thread)  PT_WAIT_WHILE((pt), PT_SCHEDULE(thread))
+
+#define PT_SPAWN(pt, child, thread)             \
+    do {                                        \
+        PT_INIT(child);                         \
+        PT_WAIT_THREAD((pt), (thread));         \
+    } while (0)
+
+#endif /* PT_H */
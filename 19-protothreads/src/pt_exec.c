@@ -0,0 +1,71 @@
+/*
+ * 프로토스레드 라운드 로빈 실행기
+ */
+
+#include <stddef.h>
+#include "pt_exec.h"
+
+void pt_exec_init(pt_exec_t *x) {
+    x->current = NULL;
+    x->resumes = 0;
+}
+
+void pt_exec_add(pt_exec_t *x, pt_task_t *task, pt_fn_t fn, const char *name) {
+    PT_INIT(&task->pt);
+    task->fn = fn;
+    task->name = name;
+    task->resumes = 0;
+    
+    if (x->current == NULL) {
+        task->next = task;
+        x->current = task;
+        return;
+    }
+    
+    /* 목록의 끝 = current 의 바로 앞 */
+    pt_task_t *tail = x->current;
+    while (tail->next != x->current) {
+        tail = tail->next;
+    }
+    tail->next = task;
+    task->next = x->current;
+}
+
+/* prev->next 인 task 를 목록에서 제거 */
+static void unlink(pt_exec_t *x, pt_task_t *prev, pt_task_t *task) {
+    if (task->next == task) {
+        x->current = NULL;
+        return;
+    }
+    prev->next = task->next;
+    x->current = task->next;
+}
+
+int pt_exec_step(pt_exec_t *x) {
+    pt_task_t *task = x->current;
+    
+    if (task == NULL) return 0;
+    
+    task->resumes++;
+    x->resumes++;
+    if (PT_SCHEDULE(task->fn(task))) {
+        x->current = task->next;
+        return 1;
+    }
+    
+    /* 제거에는 앞 노드가 필요 (단일 연결 원형 목록) */
+    pt_task_t *prev = task;
+    while (prev->next != task) {
+        prev = prev->next;
+    }
+    unlink(x, prev, task);
+    return x->current != NULL;
+}
+
+uint32_t pt_exec_run(pt_exec_t *x) {
+    uint32_t start = x->resumes;
+    
+    while (pt_exec_step(x)) {
+    }
+    return x->resumes - start;
+}
@@ -0,0 +1,46 @@
+/*
+ * 프로토스레드 라운드 로빈 실행기
+ *
+ * 태스크는 원형 목록으로 연결되고, 실행기는 목록을 돌며 태스크 함수를 차례로 호출합니다.
+ * 태스크 함수가 반환하는 것이 곧 "문맥 전환"입니다. 모든 태스크가 실행기의 스택 하나를 공유합니다.
+ *
+ * 태스크별 상태는 pt_task_t 를 첫 멤버로 둔 구조체에 둡니다:
+ *
+ *   typedef struct { pt_task_t task; uint32_t count; } counter_t;
+ *   static char counter(pt_task_t *t) { counter_t *c = (counter_t *)t; ... }
+ */
+
+#ifndef PT_EXEC_H
+#define PT_EXEC_H
+
+#include <stdint.h>
+#include "pt.h"
+
+typedef struct pt_task pt_task_t;
+typedef char (*pt_fn_t)(pt_task_t *task);
+
+struct pt_task {
+    pt_t pt;
+    pt_fn_t fn;
+    pt_task_t *next;        /* 원형 목록 */
+    const char *name;
+    uint32_t resumes;       /* fn 호출 횟수 */
+};
+
+typedef struct {
+    pt_task_t *current;     /* 다음에 실행할 태스크 (NULL = 비어 있음) */
+    uint32_t resumes;       /* 전체 fn 호출 횟수 = 전환 횟수 */
+} pt_exec_t;
+
+void pt_exec_init(pt_exec_t *x);
+
+/* current 바로 앞(목록의 끝)에 추가 -> 추가한 순서대로 실행 */
+void pt_exec_add(pt_exec_t *x, pt_task_t *task, pt_fn_t fn, const char *name);
+
+/* 태스크 하나를 한 번 실행. 끝난 태스크는 목록에서 뺌. 남은 태스크가 없으면 0 */
+int pt_exec_step(pt_exec_t *x);
+
+/* 모든 태스크가 끝날 때까지 실행, 전체 fn 호출 횟수 반환 */
+uint32_t pt_exec_run(pt_exec_t *x);
+
+#endif /* PT_EXEC_H */
@@ -0,0 +1,338 @@
+/*
+ * Cortex-M33 타이머 휠 실습 예제
+ * SysTick 구동 계층 타이밍 휠, 고정 풀 타이머, 지연 콜백 큐, 정렬 목록과 비교
+ */
+
+#include <stdint.h>
+#include "twheel.h"
+#include "tlist.h"
+#include "report.h"
+#include "dwt.h"
+
+#define SYST_CSR            (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR            (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR            (*(volatile uint32_t *)0xE000E018)
+#define SYST_CSR_ENABLE     (1u << 0)
+#define SYST_CSR_TICKINT    (1u << 1)
+#define SYST_CSR_CLKSOURCE  (1u << 2)
+
+#define TICK_CYCLES         25000       /* 1ms @ 25MHz */
+#define DEMO_TICKS          200
+#define DEMO_PERIODIC       256
+#define DEMO_ONESHOT        256
+#define BENCH_SPAN          10000       /* 벤치마크 타이머 지연 1..10000 tick */
+
+static uint32_t rng_state;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// ========== 1부: SysTick 구동 서비스 ==========
+
+static twheel_t wheel;
+static volatile uint32_t isr_max, isr_sum, isr_ticks;
+
+/* 핸들러는 휠만 진행 (슬롯 통째로 지연 큐에 옮김), 콜백은 스레드에서 */
+void SysTick_Handler(void) {
+    uint32_t start = dwt_cycles();
+    
+    twheel_tick(&wheel);
+    if (wheel.now == DEMO_TICKS) SYST_CSR = 0;
+    
+    uint32_t cycles = dwt_elapsed(start);
+    isr_sum += cycles;
+    if (cycles > isr_max) isr_max = cycles;
+    isr_ticks++;
+}
+
+static swtimer_t *periodic[DEMO_PERIODIC];
+static uint32_t periodic_count[DEMO_PERIODIC];
+static swtimer_t *oneshot[DEMO_ONESHOT];
+static uint32_t oneshot_delay[DEMO_ONESHOT];
+static uint32_t oneshot_count[DEMO_ONESHOT];
+static uint32_t demo_late_max, demo_callbacks, demo_pool_peak, demo_pending_left;
+
+static uint32_t periodic_period(int i) {
+    return 3 + i % 61;
+}
+
+static void periodic_fired(swtimer_t *t) {
+    periodic_count[(uint32_t)t->arg]++;
+    if (t->late > demo_late_max) demo_late_max = t->late;
+}
+
+/* 한 번짜리는 콜백에서 스스로 풀에 반환 */
+static void oneshot_fired(swtimer_t *t) {
+    oneshot_count[(uint32_t)t->arg]++;
+    if (t->late > demo_late_max) demo_late_max = t->late;
+    timer_free(t);
+}
+
+static void demo_service(void) {
+    twheel_init(&wheel);
+    rng_state = 0x2545F491u;
+    
+    for (int i = 0; i < DEMO_PERIODIC; i++) {
+        periodic[i] = timer_alloc(periodic_fired, (void *)i);
+        twheel_add(&wheel, periodic[i], periodic_period(i), periodic_period(i));
+    }
+    for (int i = 0; i < DEMO_ONESHOT; i++) {
+        oneshot_delay[i] = 1 + rng_next() % 250;
+        oneshot[i] = timer_alloc(oneshot_fired, (void *)i);
+        twheel_add(&wheel, oneshot[i], oneshot_delay[i], 0);
+    }
+    demo_pool_peak = timer_pool_used();
+    
+    SYST_RVR = TICK_CYCLES - 1;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_CLKSOURCE | SYST_CSR_TICKINT | SYST_CSR_ENABLE;
+    
+    while (wheel.now < DEMO_TICKS) {
+        demo_callbacks += twheel_run_expired(&wheel);
+    
+        /* 검사와 잠 사이의 tick 을 놓치지 않게 (18-low-power-idle 과 같은 방식) */
+        __asm volatile ("cpsid i" : : : "memory");
+        if (tlink_empty(&wheel.expired) && wheel.now < DEMO_TICKS) {
+            __asm volatile ("wfi");
+        }
+        __asm volatile ("cpsie i" : : : "memory");
+    }
+    demo_callbacks += twheel_run_expired(&wheel);
+    
+    for (int i = 0; i < DEMO_PERIODIC; i++) {
+        twheel_cancel(&wheel, periodic[i]);
+        timer_free(periodic[i]);
+    }
+    /* 아직 만료되지 않은 한 번 타이머 (발화한 것은 콜백이 이미 반환) */
+    for (int i = 0; i < DEMO_ONESHOT; i++) {
+        if (oneshot_count[i] == 0) {
+            twheel_cancel(&wheel, oneshot[i]);
+            timer_free(oneshot[i]);
+        }
+    }
+    demo_pending_left = wheel.pending;
+}
+
+// ========== 2부: 휠 대 정렬 목록 ==========
+
+typedef struct {
+    const char *name;
+    void (*init)(void);
+    void (*add)(swtimer_t *t, uint32_t delay);
+    int (*cancel)(swtimer_t *t);
+    uint32_t (*tick)(void);
+    uint32_t (*run)(void);
+    uint32_t (*work)(void);         /* 휠: cascade 횟수, 목록: 지나간 노드 수 */
+} timer_ops_t;
+
+static tlist_t list;
+
+static void wheel_init_op(void) { twheel_init(&wheel); }
+static void wheel_add_op(swtimer_t *t, uint32_t delay) { twheel_add(&wheel, t, delay, 0); }
+static int wheel_cancel_op(swtimer_t *t) { return twheel_cancel(&wheel, t); }
+static uint32_t wheel_tick_op(void) { return twheel_tick(&wheel); }
+static uint32_t wheel_run_op(void) { return twheel_run_expired(&wheel); }
+static uint32_t wheel_work_op(void) { return wheel.cascaded; }
+
+static void list_init_op(void) { tlist_init(&list); }
+static void list_add_op(swtimer_t *t, uint32_t delay) { tlist_add(&list, t, delay, 0); }
+static int list_cancel_op(swtimer_t *t) { return tlist_cancel(&list, t); }
+static uint32_t list_tick_op(void) { return tlist_tick(&list); }
+static uint32_t list_run_op(void) { return tlist_run_expired(&list); }
+static uint32_t list_work_op(void) { return list.visited; }
+
+static const timer_ops_t designs[2] = {
+    { "wheel", wheel_init_op, wheel_add_op, wheel_cancel_op, wheel_tick_op, wheel_run_op, wheel_work_op },
+    { "list",  list_init_op,  list_add_op,  list_cancel_op,  list_tick_op,  list_run_op,  list_work_op  },
+};
+
+static const uint32_t bench_sizes[] = { 250, 500, 1000, 2000 };
+
+#define BENCH_SIZES ((int)(sizeof(bench_sizes) / sizeof(bench_sizes[0])))
+
+typedef struct {
+    uint32_t add_avg;
+    uint32_t cancel_avg;
+    uint32_t tick_avg;
+    uint32_t tick_max;
+    uint32_t work;
+    uint32_t fired;
+    uint32_t late;
+    uint32_t order;             /* 만료 순서 해시 */
+} bench_result_t;
+
+static bench_result_t results[BENCH_SIZES][2];
+static swtimer_t *bench_timers[TIMER_POOL];
+static uint32_t bench_fired, bench_late, bench_order;
+
+static void bench_fired_cb(swtimer_t *t) {
+    bench_fired++;
+    if (t->late) bench_late++;
+    bench_order = bench_order * 31 + (uint32_t)t->arg;
+}
+
+static void bench_run(const timer_ops_t *ops, uint32_t n, bench_result_t *r) {
+    uint32_t start, cycles, sum = 0, max = 0;
+    
+    ops->init();
+    for (uint32_t i = 0; i < n; i++) {
+        bench_timers[i] = timer_alloc(bench_fired_cb, (void *)i);
+    }
+    bench_fired = 0;
+    bench_late = 0;
+    bench_order = 0;
+    
+    /* 같은 난수열 -> 두 설계가 같은 타이머 집합 */
+    rng_state = 0x9E3779B9u ^ n;
+    start = dwt_cycles();
+    for (uint32_t i = 0; i < n; i++) {
+        ops->add(bench_timers[i], 1 + rng_next() % BENCH_SPAN);
+    }
+    r->add_avg = dwt_elapsed(start) / n;
+    
+    start = dwt_cycles();
+    for (uint32_t i = 0; i < n; i += 4) {
+        ops->cancel(bench_timers[i]);
+    }
+    r->cancel_avg = dwt_elapsed(start) / ((n + 3) / 4);
+    
+    /* tick 마다 만료 처리까지 (콜백 포함) */
+    for (uint32_t tick = 0; tick < BENCH_SPAN; tick++) {
+        start = dwt_cycles();
+        ops->tick();
+        ops->run();
+        cycles = dwt_elapsed(start);
+        sum += cycles;
+        if (cycles > max) max = cycles;
+    }
+    r->tick_avg = sum / BENCH_SPAN;
+    r->tick_max = max;
+    r->work = ops->work();
+    r->fired = bench_fired;
+    r->late = bench_late;
+    r->order = bench_order;
+    
+    for (uint32_t i = 0; i < n; i++) {
+        timer_free(bench_timers[i]);
+    }
+}
+
+static void print_bench_row(uint32_t n, const char *name, const bench_result_t *r) {
+    print_number(n, 6);
+    print_string("  ");
+    print_padded(name, 6);
+    print_number(r->add_avg, 8);
+    print_number(r->cancel_avg, 8);
+    print_number(r->tick_avg, 9);
+    print_number(r->tick_max, 9);
+    print_number(r->work, 9);
+    print_number(r->fired, 7);
+    print_string("\n");
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 계층 타이밍 휠 ===\n");
+    print_string("4단 x 64 슬롯, tick = 1ms (SysTick 25000 cycles), 풀 2048개\n");
+    
+    dwt_init();
+    timer_pool_init();
+    
+    demo_service();
+    
+    asm volatile ("nop"); // Breakpoint 1: SysTick 서비스 종료 (wheel, periodic_count)
+    int periodic_ok = 1;
+    int oneshot_ok = 1;
+    uint32_t expected_callbacks = 0;
+    
+    for (int i = 0; i < DEMO_PERIODIC; i++) {
+        uint32_t expected = DEMO_TICKS / periodic_period(i);
+        if (periodic_count[i] != expected) periodic_ok = 0;
+        expected_callbacks += expected;
+    }
+    for (int i = 0; i < DEMO_ONESHOT; i++) {
+        uint32_t expected = oneshot_delay[i] <= DEMO_TICKS;
+        if (oneshot_count[i] != expected) oneshot_ok = 0;
+        expected_callbacks += expected;
+    }
+    
+    print_string("\nSysTick 서비스: ");
+    print_number(DEMO_PERIODIC, 0);
+    print_string(" 주기 + ");
+    print_number(DEMO_ONESHOT, 0);
+    print_string(" 한 번 타이머, ");
+    print_number(DEMO_TICKS, 0);
+    print_string(" tick\n  콜백 ");
+    print_number(demo_callbacks, 0);
+    print_string("번 (기대 ");
+    print_number(expected_callbacks, 0);
+    print_string("), cascade ");
+    print_number(wheel.cascaded, 0);
+    print_string("번, 최대 늦음 ");
+    print_number(demo_late_max, 0);
+    print_string(" tick\n  SysTick 핸들러 cycles: avg ");
+    print_number(isr_ticks ? isr_sum / isr_ticks : 0, 0);
+    print_string(", max ");
+    print_number(isr_max, 0);
+    print_string(" (");
+    print_number(isr_ticks, 0);
+    print_string(" ticks)\n  풀 사용: 최대 ");
+    print_number(demo_pool_peak, 0);
+    print_string(", 종료 후 ");
+    print_number(timer_pool_used(), 0);
+    print_string("\n");
+    
+    for (int s = 0; s < BENCH_SIZES; s++) {
+        for (int d = 0; d < 2; d++) {
+            bench_run(&designs[d], bench_sizes[s], &results[s][d]);
+        }
+    }
+    
+    asm volatile ("nop"); // Breakpoint 2: 벤치마크 종료 (results)
+    print_string("\n지연 1..10000 tick 무작위, 1/4 취소, 10000 tick 진행 (cycles)\n");
+    print_string("timers  design     add  cancel  tick avg  tick max     work  fired\n");
+    print_string("-------------------------------------------------------------------\n");
+    for (int s = 0; s < BENCH_SIZES; s++) {
+        for (int d = 0; d < 2; d++) {
+            print_bench_row(bench_sizes[s], designs[d].name, &results[s][d]);
+        }
+    }
+    print_string("work: wheel = cascade 로 옮긴 횟수, list = 삽입 위치를 찾느라 지나간 노드 수\n");
+    
+    int bench_ok = 1;
+    for (int s = 0; s < BENCH_SIZES; s++) {
+        const bench_result_t *w = &results[s][0];
+        const bench_result_t *l = &results[s][1];
+        uint32_t expected = bench_sizes[s] - (bench_sizes[s] + 3) / 4;
+        if (w->fired != expected || l->fired != expected) bench_ok = 0;
+        if (w->late || l->late || w->order != l->order) bench_ok = 0;
+    }
+    const bench_result_t *w_small = &results[0][0];
+    const bench_result_t *l_small = &results[0][1];
+    const bench_result_t *w_large = &results[BENCH_SIZES - 1][0];
+    const bench_result_t *l_large = &results[BENCH_SIZES - 1][1];
+    
+    print_string("\n결과 검증:\n");
+    check("주기 타이머 발화 수 = 200 / period", periodic_ok);
+    check("한 번 타이머: 지연 <= 200 인 것만 한 번", oneshot_ok);
+    check("지연 콜백이 같은 tick 안에 실행됨 (늦음 0)", demo_late_max == 0);
+    check("SysTick 핸들러 200번", isr_ticks == DEMO_TICKS);
+    check("풀 반환 완료 (사용 0)", timer_pool_used() == 0);
+    check("휠 pending 0 (콜백 / 취소 뒤)", demo_pending_left == 0);
+    check("벤치마크: 발화 수, 늦음 0, 만료 순서 두 설계 같음", bench_ok);
+    check("휠 등록 비용은 타이머 수와 무관 (2000개 <= 250개 x 2)", w_large->add_avg <= w_small->add_avg * 2);
+    check("목록 등록 비용은 타이머 수에 비례 (2000개 > 250개 x 4)", l_large->add_avg > l_small->add_avg * 4);
+    check("2000개: 휠 등록 < 목록 등록", w_large->add_avg < l_large->add_avg);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
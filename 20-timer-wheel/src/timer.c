@@ -0,0 +1,53 @@
+/*
+ * 소프트웨어 타이머 고정 풀 (단일 연결 free list)
+ */
+
+#include <stddef.h>
+#include "timer.h"
+
+static swtimer_t pool[TIMER_POOL];
+static swtimer_t *free_list;
+static uint32_t used;
+
+void timer_pool_init(void) {
+    free_list = NULL;
+    for (int i = TIMER_POOL - 1; i >= 0; i--) {
+        pool[i].link.next = (tlink_t *)free_list;
+        free_list = &pool[i];
+    }
+    used = 0;
+}
+
+swtimer_t *timer_alloc(swtimer_fn_t fn, void *arg) {
+    uint32_t primask = timer_lock();
+    swtimer_t *t = free_list;
+    
+    if (t != NULL) {
+        free_list = (swtimer_t *)t->link.next;
+        used++;
+    }
+    timer_unlock(primask);
+    
+    if (t == NULL) return NULL;
+    tlink_init(&t->link);
+    t->expires = 0;
+    t->period = 0;
+    t->fn = fn;
+    t->arg = arg;
+    t->late = 0;
+    t->state = TIMER_IDLE;
+    return t;
+}
+
+void timer_free(swtimer_t *t) {
+    uint32_t primask = timer_lock();
+    
+    t->link.next = (tlink_t *)free_list;
+    free_list = t;
+    used--;
+    timer_unlock(primask);
+}
+
+uint32_t timer_pool_used(void) {
+    return used;
+}
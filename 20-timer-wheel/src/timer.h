@@ -0,0 +1,101 @@
+/*
+ * 소프트웨어 타이머 노드와 고정 풀
+ *
+ * 노드는 intrusive 이중 연결 목록(tlink_t 가 첫 멤버)으로 휠 슬롯이나 정렬 목록에 직접 걸립니다.
+ * 그래서 등록/취소에 메모리 할당이 없고, 취소는 어느 목록에 있든 O(1) 입니다.
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+
+#define TIMER_POOL      2048
+
+typedef struct tlink {
+    struct tlink *next;
+    struct tlink *prev;
+} tlink_t;
+
+typedef struct swtimer swtimer_t;
+typedef void (*swtimer_fn_t)(swtimer_t *t);
+
+typedef enum {
+    TIMER_IDLE,
+    TIMER_PENDING,          /* 휠 슬롯 / 정렬 목록에 있음 */
+    TIMER_EXPIRED,          /* 지연 콜백 큐에서 실행을 기다림 */
+} timer_state_t;
+
+struct swtimer {
+    tlink_t link;           /* 첫 멤버: tlink_t * <-> swtimer_t * */
+    uint32_t expires;       /* 만료 tick (절대값) */
+    uint32_t period;        /* 0 = 한 번 */
+    swtimer_fn_t fn;
+    void *arg;
+    uint32_t late;          /* 마지막 콜백이 만료보다 늦은 tick */
+    timer_state_t state;
+};
+
+// ========== 목록 (sentinel 이 있는 원형 이중 연결) ==========
+
+static inline void tlink_init(tlink_t *head) {
+    head->next = head;
+    head->prev = head;
+}
+
+static inline int tlink_empty(const tlink_t *head) {
+    return head->next == head;
+}
+
+/* pos 앞에 n 삽입 (pos = head 이면 꼬리에 추가) */
+static inline void tlink_insert_before(tlink_t *pos, tlink_t *n) {
+    n->next = pos;
+    n->prev = pos->prev;
+    pos->prev->next = n;
+    pos->prev = n;
+}
+
+static inline void tlink_del(tlink_t *n) {
+    n->prev->next = n->next;
+    n->next->prev = n->prev;
+    n->next = n;
+    n->prev = n;
+}
+
+/* from 의 모든 노드를 to 의 꼬리로 옮김 (O(1)), from 은 빈 목록이 됨 */
+static inline void tlink_splice_tail(tlink_t *from, tlink_t *to) {
+    if (tlink_empty(from)) return;
+    from->next->prev = to->prev;
+    to->prev->next = from->next;
+    from->prev->next = to;
+    to->prev = from->prev;
+    tlink_init(from);
+}
+
+// ========== 고정 풀 ==========
+
+void timer_pool_init(void);
+
+/* 풀이 비면 NULL */
+swtimer_t *timer_alloc(swtimer_fn_t fn, void *arg);
+
+/* 먼저 취소(IDLE)한 뒤 반환할 것 */
+void timer_free(swtimer_t *t);
+
+uint32_t timer_pool_used(void);
+
+// ========== 인터럽트 잠금 (SysTick 핸들러와 공유하는 목록 보호) ==========
+
+static inline uint32_t timer_lock(void) {
+    uint32_t primask;
+    
+    __asm volatile ("mrs %0, primask" : "=r"(primask));
+    __asm volatile ("cpsid i" : : : "memory");
+    return primask;
+}
+
+static inline void timer_unlock(uint32_t primask) {
+    __asm volatile ("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+#endif /* TIMER_H */
@@ -0,0 +1,97 @@
+/*
+ * 비교용 정렬 목록 타이머
+ */
+
+#include "tlist.h"
+
+void tlist_init(tlist_t *l) {
+    tlink_init(&l->head);
+    tlink_init(&l->expired);
+    l->now = 0;
+    l->pending = 0;
+    l->visited = 0;
+}
+
+static void insert_sorted(tlist_t *l, swtimer_t *t) {
+    tlink_t *pos = l->head.next;
+    
+    /* 같은 만료는 뒤에 붙여 등록 순서 유지 */
+    while (pos != &l->head && (int32_t)(((swtimer_t *)pos)->expires - t->expires) <= 0) {
+        pos = pos->next;
+        l->visited++;
+    }
+    tlink_insert_before(pos, &t->link);
+    t->state = TIMER_PENDING;
+}
+
+void tlist_add(tlist_t *l, swtimer_t *t, uint32_t delay, uint32_t period) {
+    uint32_t primask = timer_lock();
+    
+    if (delay == 0) delay = 1;
+    t->expires = l->now + delay;
+    t->period = period;
+    insert_sorted(l, t);
+    l->pending++;
+    timer_unlock(primask);
+}
+
+int tlist_cancel(tlist_t *l, swtimer_t *t) {
+    uint32_t primask = timer_lock();
+    
+    if (t->state == TIMER_IDLE) {
+        timer_unlock(primask);
+        return 0;
+    }
+    if (t->state == TIMER_PENDING) l->pending--;
+    tlink_del(&t->link);
+    t->state = TIMER_IDLE;
+    timer_unlock(primask);
+    return 1;
+}
+
+uint32_t tlist_tick(tlist_t *l) {
+    uint32_t tick = l->now + 1;
+    uint32_t count = 0;
+    
+    while (!tlink_empty(&l->head)) {
+        swtimer_t *t = (swtimer_t *)l->head.next;
+        if ((int32_t)(t->expires - tick) > 0) break;
+        tlink_del(&t->link);
+        tlink_insert_before(&l->expired, &t->link);
+        t->state = TIMER_EXPIRED;
+        count++;
+    }
+    l->pending -= count;
+    l->now = tick;
+    return count;
+}
+
+uint32_t tlist_run_expired(tlist_t *l) {
+    uint32_t count = 0;
+    
+    while (1) {
+        uint32_t primask = timer_lock();
+    
+        if (tlink_empty(&l->expired)) {
+            timer_unlock(primask);
+            break;
+        }
+        swtimer_t *t = (swtimer_t *)l->expired.next;
+        uint32_t now = l->now;
+    
+        tlink_del(&t->link);
+        t->late = now - t->expires;
+        t->state = TIMER_IDLE;
+        if (t->period) {
+            t->expires += t->period;
+            if ((int32_t)(t->expires - now) <= 0) t->expires = now + 1;
+            insert_sorted(l, t);
+            l->pending++;
+        }
+        timer_unlock(primask);
+    
+        t->fn(t);
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,32 @@
+/*
+ * 비교용: 만료 시각 순 정렬 목록
+ *
+ * 등록: 앞에서부터 자리를 찾아 삽입 -> O(n)
+ * tick: 머리의 만료된 타이머만 확인 -> 만료 없으면 O(1), 만료된 타이머마다 한 번씩 옮김
+ * 취소: 이중 연결이므로 O(1)
+ *
+ * 노드, 풀, 지연 콜백 큐, 잠금 방식은 twheel 과 같습니다. 다른 것은 자료 구조뿐입니다.
+ * (목록은 만료 시각을 하나씩 비교해야 하므로 tick 이 노드를 걸으며 EXPIRED 로 표시합니다)
+ */
+
+#ifndef TLIST_H
+#define TLIST_H
+
+#include <stdint.h>
+#include "timer.h"
+
+typedef struct {
+    tlink_t head;               /* expires 오름차순, 같으면 등록 순 */
+    tlink_t expired;
+    volatile uint32_t now;
+    uint32_t pending;
+    uint32_t visited;           /* 통계: 삽입 위치를 찾느라 지나간 노드 수 */
+} tlist_t;
+
+void tlist_init(tlist_t *l);
+void tlist_add(tlist_t *l, swtimer_t *t, uint32_t delay, uint32_t period);
+int tlist_cancel(tlist_t *l, swtimer_t *t);
+uint32_t tlist_tick(tlist_t *l);
+uint32_t tlist_run_expired(tlist_t *l);
+
+#endif /* TLIST_H */
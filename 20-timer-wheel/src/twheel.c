@@ -0,0 +1,133 @@
+/*
+ * 계층 타이밍 휠
+ */
+
+#include "twheel.h"
+
+void twheel_init(twheel_t *w) {
+    for (int level = 0; level < TW_LEVELS; level++) {
+        for (uint32_t i = 0; i < TW_SLOTS; i++) {
+            tlink_init(&w->slots[level][i]);
+        }
+    }
+    tlink_init(&w->expired);
+    tlink_init(&w->running);
+    w->now = 0;
+    w->pending = 0;
+    w->cascaded = 0;
+}
+
+/* base = 다음에 처리할 tick. 남은 tick (expires - base) 로 단계 선택 */
+static void enqueue(twheel_t *w, swtimer_t *t, uint32_t base) {
+    uint32_t delta = t->expires - base;
+    int level = 0;
+    
+    if (delta >= TW_RANGE) {
+        delta = TW_RANGE - 1;
+        t->expires = base + delta;
+    }
+    while (level < TW_LEVELS - 1 && delta >= (1u << (TW_BITS * (level + 1)))) {
+        level++;
+    }
+    
+    tlink_insert_before(&w->slots[level][(t->expires >> (TW_BITS * level)) & TW_MASK], &t->link);
+    t->state = TIMER_PENDING;
+}
+
+void twheel_add(twheel_t *w, swtimer_t *t, uint32_t delay, uint32_t period) {
+    uint32_t primask = timer_lock();
+    
+    if (delay == 0) delay = 1;
+    t->expires = w->now + delay;
+    t->period = period;
+    enqueue(w, t, w->now + 1);
+    w->pending++;
+    timer_unlock(primask);
+}
+
+/* 노드가 슬롯이나 expired 에 있으면 tick 이 같은 목록을 고칠 수 있으므로 잠금 */
+int twheel_cancel(twheel_t *w, swtimer_t *t) {
+    uint32_t primask = timer_lock();
+    
+    if (t->state == TIMER_IDLE) {
+        timer_unlock(primask);
+        return 0;
+    }
+    tlink_del(&t->link);
+    t->state = TIMER_IDLE;
+    w->pending--;
+    timer_unlock(primask);
+    return 1;
+}
+
+/* 윗단계 슬롯 하나를 비우고, 그 타이머들을 tick 기준으로 다시 나눔 */
+static void cascade(twheel_t *w, int level, uint32_t index, uint32_t tick) {
+    tlink_t list;
+    
+    tlink_init(&list);
+    tlink_splice_tail(&w->slots[level][index], &list);
+    while (!tlink_empty(&list)) {
+        swtimer_t *t = (swtimer_t *)list.next;
+        tlink_del(&t->link);
+        enqueue(w, t, tick);
+        w->cascaded++;
+    }
+}
+
+uint32_t twheel_tick(twheel_t *w) {
+    uint32_t tick = w->now + 1;
+    uint32_t index = tick & TW_MASK;
+    
+    /* 단계 0 이 0 번 슬롯으로 돌아올 때만 윗단계를 봄 (단계 1 도 0 이면 단계 2 ...) */
+    for (int level = 1; level < TW_LEVELS && index == 0; level++) {
+        index = (tick >> (TW_BITS * level)) & TW_MASK;
+        cascade(w, level, index, tick);
+    }
+    
+    /* 슬롯을 통째로 붙이기만 함: 상태 표시와 pending 은 run_expired 가 스레드에서 */
+    tlink_t *slot = &w->slots[0][tick & TW_MASK];
+    uint32_t fired = !tlink_empty(slot);
+    
+    tlink_splice_tail(slot, &w->expired);
+    w->now = tick;
+    return fired;
+}
+
+uint32_t twheel_run_expired(twheel_t *w) {
+    uint32_t count = 0;
+    
+    while (1) {
+        uint32_t primask = timer_lock();
+    
+        if (tlink_empty(&w->running)) {
+            /* 지연 큐를 통째로 가져와 (O(1)) 인터럽트를 켠 채 EXPIRED 로 표시 */
+            tlink_splice_tail(&w->expired, &w->running);
+            timer_unlock(primask);
+            if (tlink_empty(&w->running)) break;
+            for (tlink_t *n = w->running.next; n != &w->running; n = n->next) {
+                ((swtimer_t *)n)->state = TIMER_EXPIRED;
+            }
+            continue;
+        }
+        swtimer_t *t = (swtimer_t *)w->running.next;
+        uint32_t now = w->now;
+    
+        tlink_del(&t->link);
+        t->late = now - t->expires;
+        t->state = TIMER_IDLE;
+        w->pending--;
+        if (t->period) {
+            /* 원래 만료 기준으로 다시 등록 -> 늦어도 주기가 밀리지 않음 */
+            t->expires += t->period;
+            if ((int32_t)(t->expires - now) <= 0) t->expires = now + 1;
+            enqueue(w, t, now + 1);
+            w->pending++;
+        }
+        timer_unlock(primask);
+    
+        /* 콜백은 인터럽트를 켠 채로 (콜백 안에서 add / cancel 가능) */
+        t->fn(t);
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,58 @@
+/*
+ * 계층 타이밍 휠 (4단 x 64 슬롯)
+ *
+ *   단계 0: 앞으로 64 tick 안에 만료          슬롯 = expires & 63
+ *   단계 1: 4096 tick 안                      슬롯 = (expires >> 6) & 63
+ *   단계 2: 262144 tick 안                    슬롯 = (expires >> 12) & 63
+ *   단계 3: 2^24 tick 안 (더 멀면 2^24 - 1 로 자름)
+ *
+ * 등록: 남은 tick 으로 단계를 고르고 슬롯 꼬리에 붙임 -> O(1)
+ * tick: 단계 0 슬롯 하나를 통째로 지연 콜백 큐에 옮김 (일괄 만료, 노드를 걷지 않음 -> O(1))
+ *       단계 0 이 한 바퀴 돌 때마다 윗단계 슬롯 하나를 아랫단계로 다시 나눔 (cascade)
+ *       타이머 하나는 최대 3번 cascade 되므로 tick 당 비용은 상각 O(1)
+ *
+ * twheel_tick 은 SysTick 핸들러에서, 콜백은 twheel_run_expired 로 스레드에서 실행합니다.
+ * 핸들러는 만료된 타이머 수와 관계없이 짧게 끝납니다. 노드를 TIMER_EXPIRED 로 표시하는 것도
+ * twheel_run_expired 가 인터럽트를 켠 채 합니다.
+ *
+ * twheel_add / twheel_cancel / twheel_run_expired 는 스레드에서 부르며, 휠을 건드리는 동안
+ * 스스로 timer_lock 으로 SysTick 을 막습니다 (호출자가 따로 잠글 필요 없음).
+ */
+
+#ifndef TWHEEL_H
+#define TWHEEL_H
+
+#include <stdint.h>
+#include "timer.h"
+
+#define TW_LEVELS   4
+#define TW_BITS     6
+#define TW_SLOTS    (1u << TW_BITS)
+#define TW_MASK     (TW_SLOTS - 1)
+#define TW_RANGE    (1u << (TW_BITS * TW_LEVELS))
+
+typedef struct {
+    tlink_t slots[TW_LEVELS][TW_SLOTS];
+    tlink_t expired;            /* 지연 콜백 큐 (tick 이 슬롯째로 붙임, 노드는 아직 PENDING) */
+    tlink_t running;            /* run_expired 가 가져온 묶음 (스레드 전용, 노드는 EXPIRED) */
+    volatile uint32_t now;      /* 처리한 마지막 tick */
+    uint32_t pending;           /* 등록된 뒤 콜백/취소 전인 타이머 수 (슬롯 + 두 큐) */
+    uint32_t cascaded;          /* 통계: 아랫단계로 옮긴 횟수 */
+} twheel_t;
+
+void twheel_init(twheel_t *w);
+
+/* delay tick 뒤 만료 (0 은 1 로). period 가 0 이 아니면 만료마다 다시 등록 */
+void twheel_add(twheel_t *w, swtimer_t *t, uint32_t delay, uint32_t period);
+
+/* 슬롯 또는 지연 큐에서 뺌. 실제로 빼면 1 */
+int twheel_cancel(twheel_t *w, swtimer_t *t);
+
+/* 한 tick 진행 (SysTick 핸들러), 이번 tick 에 만료된 타이머가 있으면 1.
+ * 개수는 세지 않음: 세려면 슬롯을 걸어야 하므로 */
+uint32_t twheel_tick(twheel_t *w);
+
+/* 지연 콜백 큐 비우기 (스레드), 실행한 콜백 수 반환 */
+uint32_t twheel_run_expired(twheel_t *w);
+
+#endif /* TWHEEL_H */
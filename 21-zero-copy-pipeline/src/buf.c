@@ -0,0 +1,75 @@
+/*
+ * 참조 계수 고정 버퍼 풀
+ */
+
+#include <stddef.h>
+#include "buf.h"
+
+static buf_t pool[BUF_COUNT];
+static buf_t *free_list;
+static volatile uint32_t free_count;
+
+static uint32_t lock(void) {
+    uint32_t primask;
+    
+    __asm volatile ("mrs %0, primask" : "=r"(primask));
+    __asm volatile ("cpsid i" : : : "memory");
+    return primask;
+}
+
+static void unlock(uint32_t primask) {
+    __asm volatile ("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+/* *refs += delta, 새 값 반환 */
+static uint32_t refs_add(volatile uint32_t *refs, int32_t delta) {
+    uint32_t value, failed;
+    
+    do {
+        __asm volatile ("ldrex %0, [%1]" : "=r"(value) : "r"(refs) : "memory");
+        value += delta;
+        __asm volatile ("strex %0, %2, [%1]" : "=&r"(failed) : "r"(refs), "r"(value) : "memory");
+    } while (failed);
+    return value;
+}
+
+void buf_pool_init(void) {
+    free_list = NULL;
+    for (int i = BUF_COUNT - 1; i >= 0; i--) {
+        pool[i].refs = 0;
+        pool[i].next_free = free_list;
+        free_list = &pool[i];
+    }
+    free_count = BUF_COUNT;
+}
+
+buf_t *buf_alloc(void) {
+    uint32_t primask = lock();
+    buf_t *b = free_list;
+    
+    if (b != NULL) {
+        free_list = b->next_free;
+        free_count--;
+        b->refs = 1;
+    }
+    unlock(primask);
+    return b;
+}
+
+void buf_ref(buf_t *b) {
+    refs_add(&b->refs, 1);
+}
+
+void buf_unref(buf_t *b) {
+    if (refs_add(&b->refs, -1) != 0) return;
+    
+    uint32_t primask = lock();
+    b->next_free = free_list;
+    free_list = b;
+    free_count++;
+    unlock(primask);
+}
+
+uint32_t buf_free_count(void) {
+    return free_count;
+}
@@ -0,0 +1,36 @@
+/*
+ * 참조 계수 고정 버퍼 풀
+ *
+ * 버퍼는 크기가 모두 같고(BUF_SIZE), 풀에서 꺼낼 때 refs = 1 입니다.
+ * 여러 패킷(복제본)이 같은 버퍼를 가리키면 refs 가 늘고, 마지막 buf_unref 가 풀에 돌려줍니다.
+ * refs 는 DMA 완료 인터럽트에서도 바뀔 수 있으므로 LDREX/STREX 로 갱신합니다.
+ */
+
+#ifndef BUF_H
+#define BUF_H
+
+#include <stdint.h>
+
+#define BUF_SIZE    256
+#define BUF_WORDS   (BUF_SIZE / 4)
+#define BUF_COUNT   32
+
+typedef struct buf {
+    uint32_t data[BUF_WORDS];   /* 워드 정렬 (DMA 전송 단위) */
+    volatile uint32_t refs;
+    struct buf *next_free;
+} buf_t;
+
+void buf_pool_init(void);
+
+/* refs = 1 로 꺼냄, 풀이 비면 NULL */
+buf_t *buf_alloc(void);
+
+void buf_ref(buf_t *b);
+
+/* refs 를 하나 줄이고 0 이 되면 풀에 반환 */
+void buf_unref(buf_t *b);
+
+uint32_t buf_free_count(void);
+
+#endif /* BUF_H */
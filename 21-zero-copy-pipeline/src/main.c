@@ -0,0 +1,390 @@
+/*
+ * Cortex-M33 제로 카피 파이프라인 실습 예제
+ * 참조 계수 버퍼 + 스캐터-개더 디스크립터, 생산자 -> 필터 -> 소비자 (+ 모니터), 복사 방식과 처리량 비교
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "buf.h"
+#include "pkt.h"
+#include "report.h"
+#include "dwt.h"
+
+#define MESSAGES        200
+#define QUEUE_DEPTH     8               /* 2의 거듭제곱 */
+#define HEADER_BYTES    8               /* 4의 배수 (pkt_pull) */
+#define MAGIC           0xC0DEu
+#define MONITOR_EVERY   4               /* 네 번째 메시지마다 모니터에 복제 */
+#define PAYLOAD_MAX     1024
+#define FRAME_WORDS_MAX ((HEADER_BYTES + PAYLOAD_MAX) / 4)
+
+#if HEADER_BYTES % 4 != 0
+#error "HEADER_BYTES 는 4의 배수여야 합니다 (디스크립터 off 는 워드 단위)"
+#endif
+
+// ========== 메시지 형식과 검사합 ==========
+
+/*
+ * 프레임 워드 k:  0 = MAGIC << 16 | seq,  1 = 페이로드 바이트 수,  2.. = 페이로드
+ */
+static inline uint32_t payload_word(uint32_t seq, uint32_t i) {
+    return seq * 0x9E3779B9u + i;
+}
+
+static inline uint32_t frame_word(uint32_t seq, uint32_t payload, uint32_t k) {
+    if (k == 0) return MAGIC << 16 | (seq & 0xFFFF);
+    if (k == 1) return payload;
+    return payload_word(seq, k - 2);
+}
+
+/* 순서에 민감한 검사합 (구간이 잘못 이어지면 달라짐) */
+static uint32_t checksum_words(uint32_t sum, const uint32_t *w, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        sum = (sum << 1 | sum >> 31) ^ w[i];
+    }
+    return sum;
+}
+
+static uint32_t expected_checksum(uint32_t payload) {
+    uint32_t sum = 0;
+    
+    for (uint32_t seq = 0; seq < MESSAGES; seq++) {
+        for (uint32_t i = 0; i < payload / 4; i++) {
+            sum = (sum << 1 | sum >> 31) ^ payload_word(seq, i);
+        }
+    }
+    return sum;
+}
+
+/* 복사 방식에서 단계 사이 복사 (워드 단위) */
+static uint32_t bytes_copied;
+
+static void copy_words(uint32_t *dst, const uint32_t *src, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = src[i];
+    }
+    bytes_copied += n * 4;
+}
+
+// ========== 단계 사이 큐 (협력형 단일 스레드, 포인터 링) ==========
+
+typedef struct {
+    void *slot[QUEUE_DEPTH];
+    uint32_t head;
+    uint32_t tail;
+} pq_t;
+
+static int pq_full(const pq_t *q) { return q->head - q->tail == QUEUE_DEPTH; }
+static int pq_empty(const pq_t *q) { return q->head == q->tail; }
+static void pq_push(pq_t *q, void *p) { q->slot[q->head++ % QUEUE_DEPTH] = p; }
+static void *pq_pop(pq_t *q) { return q->slot[q->tail++ % QUEUE_DEPTH]; }
+
+// ========== 실행 결과 ==========
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t checksum;
+    uint32_t consumed;
+    uint32_t monitored;
+    uint32_t monitor_bad;       /* 모니터가 본 첫 워드가 틀린 수 */
+    uint32_t header_bad;
+    uint32_t stalls;            /* 생산자가 버퍼/슬롯이 없어 기다린 횟수 */
+    uint32_t copied;
+    uint32_t shared;            /* 복제본이 원본과 같은 버퍼를 가리킨 수 (refs == 2) */
+} run_result_t;
+
+static run_result_t *res;
+static uint32_t payload_bytes;
+static uint32_t produced;
+
+// ========== 제로 카피: 패킷 포인터만 이동 ==========
+
+static pq_t zc_rx, zc_work, zc_mon;
+
+/* "DMA 수신": 풀 버퍼에 직접 채우고 디스크립터로 이어 붙임 */
+static int zc_produce(void) {
+    uint32_t words = (HEADER_BYTES + payload_bytes) / 4;
+    uint32_t nbufs = (words + BUF_WORDS - 1) / BUF_WORDS;
+    
+    if (produced == MESSAGES) return 0;
+    if (pq_full(&zc_rx) || buf_free_count() < nbufs || desc_free_count() < nbufs || pkt_free_count() == 0) {
+        res->stalls++;
+        return 0;
+    }
+    
+    pkt_t *p = pkt_alloc();
+    p->tag = produced;
+    for (uint32_t k = 0; k < words; ) {
+        buf_t *b = buf_alloc();
+        uint32_t n = words - k < BUF_WORDS ? words - k : BUF_WORDS;
+        for (uint32_t i = 0; i < n; i++) {
+            b->data[i] = frame_word(produced, payload_bytes, k + i);
+        }
+        pkt_append(p, b, 0, n * 4);
+        k += n;
+    }
+    pq_push(&zc_rx, p);
+    produced++;
+    return 1;
+}
+
+/* 헤더 검사 후 떼어 냄 (off 조정), 일부는 버퍼를 공유하는 복제본을 모니터로 */
+static int zc_filter(void) {
+    if (pq_empty(&zc_rx) || pq_full(&zc_work) || pq_full(&zc_mon)) return 0;
+    
+    pkt_t *p = pq_pop(&zc_rx);
+    const uint32_t *header = desc_words(p->head);
+    
+    if (header[0] != (MAGIC << 16 | (p->tag & 0xFFFF)) || header[1] != p->len - HEADER_BYTES) {
+        res->header_bad++;
+    }
+    if (pkt_pull(p, HEADER_BYTES) < 0) {
+        res->header_bad++;
+    }
+    
+    if (p->tag % MONITOR_EVERY == 0) {
+        pkt_t *c = pkt_clone(p);
+        if (c != NULL) {
+            if (c->head->buf == p->head->buf && p->head->buf->refs == 2) res->shared++;
+            pq_push(&zc_mon, c);
+        }
+    }
+    pq_push(&zc_work, p);
+    return 1;
+}
+
+/* 구간을 차례로 읽어 검사합, 다 쓰면 반환 */
+static int zc_consume(void) {
+    if (pq_empty(&zc_work)) return 0;
+    
+    pkt_t *p = pq_pop(&zc_work);
+    for (const desc_t *d = p->head; d != NULL; d = d->next) {
+        res->checksum = checksum_words(res->checksum, desc_words(d), d->len / 4);
+    }
+    pkt_free(p);
+    res->consumed++;
+    return 1;
+}
+
+static int zc_monitor(void) {
+    if (pq_empty(&zc_mon)) return 0;
+    
+    pkt_t *c = pq_pop(&zc_mon);
+    if (desc_words(c->head)[0] != payload_word(c->tag, 0) || c->len != payload_bytes) res->monitor_bad++;
+    pkt_free(c);
+    res->monitored++;
+    return 1;
+}
+
+// ========== 복사 방식: 단계마다 자기 버퍼, 넘길 때 복사 ==========
+
+typedef struct {
+    uint32_t len;                       /* 바이트 */
+    uint32_t data[FRAME_WORDS_MAX];
+} frame_t;
+
+typedef struct {
+    frame_t slot[QUEUE_DEPTH];
+    uint32_t head;
+    uint32_t tail;
+} fq_t;
+
+static fq_t cp_rx, cp_work, cp_mon;
+static uint32_t rx_dma[FRAME_WORDS_MAX];    /* 고정 수신 버퍼 (다음 수신 전에 비워야 함) */
+
+static int fq_full(const fq_t *q) { return q->head - q->tail == QUEUE_DEPTH; }
+static int fq_empty(const fq_t *q) { return q->head == q->tail; }
+static frame_t *fq_back(fq_t *q) { return &q->slot[q->head % QUEUE_DEPTH]; }
+static frame_t *fq_front(fq_t *q) { return &q->slot[q->tail % QUEUE_DEPTH]; }
+
+static int cp_produce(void) {
+    uint32_t words = (HEADER_BYTES + payload_bytes) / 4;
+    
+    if (produced == MESSAGES) return 0;
+    if (fq_full(&cp_rx)) {
+        res->stalls++;
+        return 0;
+    }
+    
+    for (uint32_t k = 0; k < words; k++) {
+        rx_dma[k] = frame_word(produced, payload_bytes, k);
+    }
+    frame_t *f = fq_back(&cp_rx);
+    copy_words(f->data, rx_dma, words);
+    f->len = words * 4;
+    cp_rx.head++;
+    produced++;
+    return 1;
+}
+
+static int cp_filter(void) {
+    if (fq_empty(&cp_rx) || fq_full(&cp_work) || fq_full(&cp_mon)) return 0;
+    
+    frame_t *in = fq_front(&cp_rx);
+    uint32_t seq = in->data[0] & 0xFFFF;
+    uint32_t words = (in->len - HEADER_BYTES) / 4;
+    
+    if (in->data[0] >> 16 != MAGIC || in->data[1] != in->len - HEADER_BYTES) res->header_bad++;
+    
+    if (seq % MONITOR_EVERY == 0) {
+        frame_t *m = fq_back(&cp_mon);
+        copy_words(m->data, in->data + HEADER_BYTES / 4, words);
+        m->len = words * 4;
+        cp_mon.head++;
+    }
+    frame_t *out = fq_back(&cp_work);
+    copy_words(out->data, in->data + HEADER_BYTES / 4, words);
+    out->len = words * 4;
+    cp_work.head++;
+    cp_rx.tail++;
+    return 1;
+}
+
+static int cp_consume(void) {
+    if (fq_empty(&cp_work)) return 0;
+    
+    frame_t *f = fq_front(&cp_work);
+    res->checksum = checksum_words(res->checksum, f->data, f->len / 4);
+    cp_work.tail++;
+    res->consumed++;
+    return 1;
+}
+
+static int cp_monitor(void) {
+    if (fq_empty(&cp_mon)) return 0;
+    
+    frame_t *f = fq_front(&cp_mon);
+    uint32_t seq = res->monitored * MONITOR_EVERY;
+    if (f->data[0] != payload_word(seq, 0) || f->len != payload_bytes) res->monitor_bad++;
+    cp_mon.tail++;
+    res->monitored++;
+    return 1;
+}
+
+// ========== 실행 ==========
+
+typedef struct {
+    const char *name;
+    int (*produce)(void);
+    int (*filter)(void);
+    int (*consume)(void);
+    int (*monitor)(void);
+} pipeline_t;
+
+static const pipeline_t pipelines[2] = {
+    { "zero-copy", zc_produce, zc_filter, zc_consume, zc_monitor },
+    { "copy",      cp_produce, cp_filter, cp_consume, cp_monitor },
+};
+
+static const uint32_t payload_sizes[] = { 64, 256, 1024 };
+
+#define SIZES ((int)(sizeof(payload_sizes) / sizeof(payload_sizes[0])))
+
+static run_result_t results[SIZES][2];
+static int pools_ok = 1;
+
+static void run_pipeline(const pipeline_t *pl, uint32_t payload, run_result_t *r) {
+    res = r;
+    payload_bytes = payload;
+    produced = 0;
+    bytes_copied = 0;
+    
+    /* 생산자만 두 번: 뒤 단계보다 빨라서 큐와 풀이 차고 역압(stalls)이 생김 */
+    uint32_t start = dwt_cycles();
+    while (r->consumed < MESSAGES || produced < MESSAGES ||
+           r->monitored < (MESSAGES + MONITOR_EVERY - 1) / MONITOR_EVERY) {
+        pl->produce();
+        pl->produce();
+        pl->filter();
+        pl->monitor();
+        pl->consume();
+    }
+    r->cycles = dwt_elapsed(start);
+    r->copied = bytes_copied;
+    
+    if (buf_free_count() != BUF_COUNT || desc_free_count() != DESC_COUNT || pkt_free_count() != PKT_COUNT) {
+        pools_ok = 0;
+    }
+}
+
+static void print_row(uint32_t payload, const char *name, const run_result_t *r) {
+    print_number(payload, 7);
+    print_string("  ");
+    print_padded(name, 10);
+    print_number(r->cycles / MESSAGES, 11);
+    print_number((uint32_t)((uint64_t)payload * MESSAGES * 1000 / r->cycles), 13);
+    print_number(r->copied / MESSAGES, 11);
+    print_number(r->stalls, 8);
+    print_string("\n");
+}
+
+int main(void) {
+    print_string("=== Cortex-M33 제로 카피 파이프라인 ===\n");
+    print_string("버퍼 32 x 256B, 디스크립터 64, 패킷 32, 큐 깊이 8, 메시지 200개\n");
+    
+    dwt_init();
+    buf_pool_init();
+    pkt_pool_init();
+    
+    for (int s = 0; s < SIZES; s++) {
+        for (int d = 0; d < 2; d++) {
+            run_pipeline(&pipelines[d], payload_sizes[s], &results[s][d]);
+        }
+    }
+    
+    asm volatile ("nop"); // Breakpoint 1: 모든 실행 종료 (results)
+    print_string("\npayload  design     cycles/msg  bytes/kcycle  copied/msg  stalls\n");
+    print_string("-------------------------------------------------------------------\n");
+    for (int s = 0; s < SIZES; s++) {
+        for (int d = 0; d < 2; d++) {
+            print_row(payload_sizes[s], pipelines[d].name, &results[s][d]);
+        }
+    }
+    print_string("copied/msg: 단계 사이에 복사한 바이트 (모니터 복제 포함)\n");
+    print_string("RAM: 제로 카피 풀 ");
+    print_number(BUF_COUNT * sizeof(buf_t) + DESC_COUNT * sizeof(desc_t) + PKT_COUNT * sizeof(pkt_t), 0);
+    print_string(" bytes, 복사 방식 큐 3개 ");
+    print_number(3 * sizeof(fq_t) + sizeof(rx_dma), 0);
+    print_string(" bytes\n");
+    
+    int checksum_ok = 1;
+    int count_ok = 1;
+    int header_ok = 1;
+    int monitor_ok = 1;
+    uint32_t monitored = (MESSAGES + MONITOR_EVERY - 1) / MONITOR_EVERY;
+    
+    for (int s = 0; s < SIZES; s++) {
+        uint32_t expected = expected_checksum(payload_sizes[s]);
+        for (int d = 0; d < 2; d++) {
+            const run_result_t *r = &results[s][d];
+            if (r->checksum != expected) checksum_ok = 0;
+            if (r->consumed != MESSAGES || r->monitored != monitored) count_ok = 0;
+            if (r->header_bad) header_ok = 0;
+            if (r->monitor_bad) monitor_ok = 0;
+        }
+    }
+    const run_result_t *zc_large = &results[SIZES - 1][0];
+    const run_result_t *cp_large = &results[SIZES - 1][1];
+    
+    print_string("\n결과 검증:\n");
+    check("검사합 = 기대값 (두 방식, 모든 크기)", checksum_ok);
+    check("소비 200개, 모니터 50개", count_ok);
+    check("헤더 검사 통과", header_ok);
+    check("모니터가 받은 복제본 내용", monitor_ok);
+    check("복제본이 원본 버퍼를 공유 (refs == 2)",
+          results[0][0].shared == monitored && results[1][0].shared == monitored &&
+          zc_large->shared == monitored);
+    check("제로 카피: 단계 사이 복사 0 바이트",
+          results[0][0].copied == 0 && results[1][0].copied == 0 && zc_large->copied == 0);
+    check("버퍼 / 디스크립터 / 패킷 풀 모두 반환", pools_ok);
+    check("1024B: 제로 카피가 복사 방식보다 빠름", zc_large->cycles < cp_large->cycles);
+    
+    print_string("\n");
+    if (check_failures) {
+        print_number(check_failures, 0);
+        print_string(" check(s) MISMATCH\n");
+        exit_program(1);
+    }
+    print_string("모든 검사 통과\n");
+    exit_program(0);
+}
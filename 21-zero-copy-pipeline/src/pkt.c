@@ -0,0 +1,137 @@
+/*
+ * 스캐터-개더 디스크립터 체인
+ */
+
+#include <stddef.h>
+#include "pkt.h"
+
+static desc_t desc_pool[DESC_COUNT];
+static desc_t *desc_free;
+static uint32_t desc_free_n;
+
+static pkt_t pkt_pool[PKT_COUNT];
+static pkt_t *pkt_free_list;
+static uint32_t pkt_free_n;
+
+void pkt_pool_init(void) {
+    desc_free = NULL;
+    for (int i = DESC_COUNT - 1; i >= 0; i--) {
+        desc_pool[i].next = desc_free;
+        desc_free = &desc_pool[i];
+    }
+    desc_free_n = DESC_COUNT;
+    
+    pkt_free_list = NULL;
+    for (int i = PKT_COUNT - 1; i >= 0; i--) {
+        pkt_pool[i].next_free = pkt_free_list;
+        pkt_free_list = &pkt_pool[i];
+    }
+    pkt_free_n = PKT_COUNT;
+}
+
+static desc_t *desc_alloc(void) {
+    desc_t *d = desc_free;
+    
+    if (d != NULL) {
+        desc_free = d->next;
+        desc_free_n--;
+        d->next = NULL;
+    }
+    return d;
+}
+
+static void desc_release(desc_t *d) {
+    buf_unref(d->buf);
+    d->next = desc_free;
+    desc_free = d;
+    desc_free_n++;
+}
+
+pkt_t *pkt_alloc(void) {
+    pkt_t *p = pkt_free_list;
+    
+    if (p == NULL) return NULL;
+    pkt_free_list = p->next_free;
+    pkt_free_n--;
+    p->head = NULL;
+    p->tail = NULL;
+    p->len = 0;
+    p->tag = 0;
+    return p;
+}
+
+int pkt_append(pkt_t *p, buf_t *b, uint32_t off, uint32_t len) {
+    if ((off | len) % 4 != 0) return -1;
+    
+    desc_t *d = desc_alloc();
+    
+    if (d == NULL) return -1;
+    d->buf = b;
+    d->off = off;
+    d->len = len;
+    if (p->tail != NULL) {
+        p->tail->next = d;
+    } else {
+        p->head = d;
+    }
+    p->tail = d;
+    p->len += len;
+    return 0;
+}
+
+int pkt_pull(pkt_t *p, uint32_t n) {
+    if (n % 4 != 0) return -1;
+    if (n > p->len) n = p->len;
+    p->len -= n;
+    
+    while (n > 0) {
+        desc_t *d = p->head;
+        if (n < d->len) {
+            d->off += n;
+            d->len -= n;
+            return 0;
+        }
+        n -= d->len;
+        p->head = d->next;
+        if (p->head == NULL) p->tail = NULL;
+        desc_release(d);
+    }
+    return 0;
+}
+
+pkt_t *pkt_clone(const pkt_t *p) {
+    pkt_t *c = pkt_alloc();
+    
+    if (c == NULL) return NULL;
+    c->tag = p->tag;
+    for (const desc_t *d = p->head; d != NULL; d = d->next) {
+        buf_ref(d->buf);
+        if (pkt_append(c, d->buf, d->off, d->len) < 0) {
+            buf_unref(d->buf);
+            pkt_free(c);
+            return NULL;
+        }
+    }
+    return c;
+}
+
+void pkt_free(pkt_t *p) {
+    desc_t *d = p->head;
+    
+    while (d != NULL) {
+        desc_t *next = d->next;
+        desc_release(d);
+        d = next;
+    }
+    p->next_free = pkt_free_list;
+    pkt_free_list = p;
+    pkt_free_n++;
+}
+
+uint32_t desc_free_count(void) {
+    return desc_free_n;
+}
+
+uint32_t pkt_free_count(void) {
+    return pkt_free_n;
+}
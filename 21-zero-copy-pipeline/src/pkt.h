@@ -0,0 +1,66 @@
+/*
+ * 스캐터-개더 디스크립터 체인
+ *
+ * 패킷 하나 = 디스크립터 목록. 디스크립터는 버퍼의 한 구간(off, len)을 가리킵니다.
+ * 링크드 리스트 DMA 의 디스크립터(다음 주소, 버퍼 주소, 길이)와 같은 모양입니다.
+ *
+ *   pkt --> desc{buf 3, off 8, len 248} --> desc{buf 7, off 0, len 256} --> ...
+ *
+ * 단계 사이에는 pkt 포인터만 넘깁니다 (소유권 이전, 바이트 복사 없음).
+ *   pkt_pull:  앞쪽 n 바이트 제거 = 디스크립터의 off/len 조정 (헤더 떼기)
+ *   pkt_clone: 디스크립터만 새로 만들고 버퍼는 공유 (refs + 1)
+ *
+ * 디스크립터/패킷 풀은 스레드의 파이프라인 단계에서만 쓰므로 잠금이 없습니다 (버퍼 refs 만 원자적).
+ */
+
+#ifndef PKT_H
+#define PKT_H
+
+#include <stdint.h>
+#include "buf.h"
+
+#define DESC_COUNT  (2 * BUF_COUNT)     /* 버퍼마다 원본 + 복제본 하나 */
+#define PKT_COUNT   32
+
+typedef struct desc {
+    struct desc *next;
+    buf_t *buf;
+    uint16_t off;               /* 바이트, 4의 배수 */
+    uint16_t len;               /* 바이트, 4의 배수 */
+} desc_t;
+
+typedef struct pkt {
+    desc_t *head;
+    desc_t *tail;
+    uint32_t len;               /* 전체 바이트 */
+    uint32_t tag;               /* 사용자 값 (복제본에도 복사) */
+    struct pkt *next_free;
+} pkt_t;
+
+void pkt_pool_init(void);
+
+/* 빈 패킷, 풀이 비면 NULL */
+pkt_t *pkt_alloc(void);
+
+/* 버퍼 구간을 꼬리에 붙임. 호출자의 참조 하나를 패킷이 넘겨받음.
+ * off/len 이 4의 배수가 아니거나 디스크립터가 없으면 -1 (참조는 호출자에게 남음) */
+int pkt_append(pkt_t *p, buf_t *b, uint32_t off, uint32_t len);
+
+/* 앞쪽 n 바이트 제거, 다 쓴 디스크립터는 버퍼 참조와 함께 반환.
+ * n 이 4의 배수가 아니면 -1 (패킷은 그대로) - desc_words() 가 off / 4 로 워드 단위 접근 */
+int pkt_pull(pkt_t *p, uint32_t n);
+
+/* 같은 버퍼를 가리키는 새 패킷, 풀이 부족하면 NULL */
+pkt_t *pkt_clone(const pkt_t *p);
+
+/* 디스크립터와 버퍼 참조, 패킷을 모두 반환 */
+void pkt_free(pkt_t *p);
+
+static inline const uint32_t *desc_words(const desc_t *d) {
+    return d->buf->data + d->off / 4;
+}
+
+uint32_t desc_free_count(void);
+uint32_t pkt_free_count(void);
+
+#endif /* PKT_H */
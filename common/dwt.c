@@ -0,0 +1,44 @@
+/*
+ * 사이클 카운터 초기화
+ *
+ * 실제 Cortex-M33: DEMCR.TRCENA -> DWT_CTRL.CYCCNTENA 로 CYCCNT 활성화.
+ * QEMU mps2-an505: DWT 레지스터가 RAZ/WI 이므로 CYCCNT가 증가하지 않으면
+ * 32비트 자유 실행 Dual Timer 1로 대체합니다. (-icount 와 함께 쓰면 결정적)
+ * 이때 값은 CPU 사이클이 아니라 주변장치 클럭 tick 입니다.
+ */
+
+#include "dwt.h"
+
+int dwt_use_timer;
+uint32_t dwt_overhead;
+
+void dwt_init(void)
+{
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    
+    uint32_t before = DWT_CYCCNT;
+    for (volatile int i = 0; i < 16; i++) {
+    }
+    
+    if (DWT_CYCCNT == before) {
+        /* CONTROL: EN(bit7) | 자유 실행(MODE=0) | 32비트(bit1), 인터럽트 없음 */
+        DUALTIMER1_CONTROL = 0;
+        DUALTIMER1_LOAD = 0xFFFFFFFF;
+        DUALTIMER1_CONTROL = (1u << 7) | (1u << 1);
+        dwt_use_timer = 1;
+    }
+    
+    /* 측정 오버헤드: 빈 구간을 여러 번 재서 최솟값 */
+    dwt_overhead = 0;
+    uint32_t best = 0xFFFFFFFF;
+    for (int i = 0; i < 8; i++) {
+        uint32_t start = dwt_cycles();
+        uint32_t delta = dwt_cycles() - start;
+        if (delta < best) {
+            best = delta;
+        }
+    }
+    dwt_overhead = best;
+}
@@ -0,0 +1,44 @@
+/*
+ * 사이클 카운터 (DWT CYCCNT, QEMU에서는 CMSDK Dual Timer로 대체)
+ * 측정하는 모듈이 공유: 각 Makefile 이 ../common/dwt.c 를 함께 빌드
+ */
+
+#ifndef DWT_H
+#define DWT_H
+
+#include <stdint.h>
+
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004)
+#define DEMCR               (*(volatile uint32_t *)0xE000EDFC)
+#define DEMCR_TRCENA        (1u << 24)
+#define DWT_CTRL_CYCCNTENA  (1u << 0)
+
+/* MPS2-AN505 Dual Timer 1 (Secure 별칭) - 감소 카운터, 코어 클럭이 아닌 주변장치 클럭으로 동작 */
+#define DUALTIMER1_LOAD     (*(volatile uint32_t *)0x50002000)
+#define DUALTIMER1_VALUE    (*(volatile uint32_t *)0x50002004)
+#define DUALTIMER1_CONTROL  (*(volatile uint32_t *)0x50002008)
+
+/* 1이면 DWT 대신 Dual Timer 사용 (QEMU는 DWT를 구현하지 않아 CYCCNT가 0에 머묾) */
+extern int dwt_use_timer;
+/* dwt_cycles() 두 번 연속 호출의 차이 - 측정값에서 빼는 고정 오버헤드 */
+extern uint32_t dwt_overhead;
+
+void dwt_init(void);
+
+static inline uint32_t dwt_cycles(void)
+{
+    if (dwt_use_timer) {
+        return ~DUALTIMER1_VALUE;   /* 감소 카운터를 증가 방향으로 */
+    }
+    return DWT_CYCCNT;
+}
+
+/* start 이후 경과 사이클 (읽기 오버헤드 보정) */
+static inline uint32_t dwt_elapsed(uint32_t start)
+{
+    uint32_t delta = dwt_cycles() - start;
+    return delta > dwt_overhead ? delta - dwt_overhead : 0;
+}
+
+#endif /* DWT_H */
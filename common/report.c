@@ -0,0 +1,71 @@
+/*
+ * 세미호스팅 출력, 측정 통계, 결과 검증
+ */
+
+#include "report.h"
+
+int print_string(const char *str) {
+    register int r0 asm("r0");
+    register int r1 asm("r1");
+    
+    r0 = 0x04;  /* SYS_WRITE0 */
+    r1 = (int)str;
+    
+    asm volatile ("bkpt #0xAB" : "=r"(r0) : "r"(r0), "r"(r1) : "memory");
+    return r0;
+}
+
+void print_number(unsigned int value, int width) {
+    char buffer[12];
+    int i = 11;
+    
+    buffer[i] = '\0';
+    do {
+        buffer[--i] = '0' + (value % 10);
+        value /= 10;
+        width--;
+    } while (value > 0 && i > 0);
+    while (width-- > 0 && i > 0) {
+        buffer[--i] = ' ';
+    }
+    print_string(&buffer[i]);
+}
+
+void print_padded(const char *str, int width) {
+    print_string(str);
+    for (const char *p = str; *p; p++) {
+        width--;
+    }
+    while (width-- > 0) {
+        print_string(" ");
+    }
+}
+
+void exit_program(int code) {
+    register int r0 asm("r0");
+    register int r1 asm("r1");
+    
+    r0 = 0x18;  /* SYS_EXIT */
+    r1 = code == 0 ? 0x20026 : 0x20023;  /* ApplicationExit / RunTimeErrorUnknown */
+    
+    asm volatile ("bkpt #0xAB" : : "r"(r0), "r"(r1) : "memory");
+    while (1);
+}
+
+void print_stats(const char *name, int name_width, const stats_t *s) {
+    print_padded(name, name_width);
+    print_number(s->min, 8);
+    print_number(stats_avg(s), 8);
+    print_number(s->max, 8);
+    print_number(s->count, 9);
+    print_string("\n");
+}
+
+int check_failures;
+
+void check(const char *name, int ok) {
+    print_string(ok ? "  OK        " : "  MISMATCH  ");
+    print_string(name);
+    print_string("\n");
+    if (!ok) check_failures++;
+}
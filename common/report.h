@@ -0,0 +1,48 @@
+/*
+ * 세미호스팅 출력, 측정 통계, 결과 검증 (08 이후 모듈 공용)
+ * 각 Makefile 이 ../common/report.c 를 함께 빌드
+ */
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <stdint.h>
+
+int print_string(const char *str);
+
+/* 오른쪽 정렬로 width 칸 (0 이면 정렬 없음) */
+void print_number(unsigned int value, int width);
+
+/* str 뒤를 공백으로 채워 width 칸 */
+void print_padded(const char *str, int width);
+
+/* 0 이면 ApplicationExit (QEMU 종료 코드 0), 아니면 실패로 종료 */
+void exit_program(int code);
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint32_t count;
+} stats_t;
+
+static inline void stats_add(stats_t *s, uint32_t value) {
+    if (s->count == 0 || value < s->min) s->min = value;
+    if (value > s->max) s->max = value;
+    s->sum += value;
+    s->count++;
+}
+
+static inline uint32_t stats_avg(const stats_t *s) {
+    return s->count ? s->sum / s->count : 0;
+}
+
+/* name 을 name_width 칸으로 채운 뒤 min / avg / max / count */
+void print_stats(const char *name, int name_width, const stats_t *s);
+
+/* "OK" / "MISMATCH" 한 줄 출력, 실패 수는 check_failures 에 누적 */
+extern int check_failures;
+
+void check(const char *name, int ok);
+
+#endif /* REPORT_H */
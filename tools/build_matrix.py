@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+빌드 변형 매트릭스 (-O0 / -O2 / -Os / -O2+LTO)
+
+각 모듈을 최적화 변형별로 build/matrix-<variant>/ 에 빌드하고
+  - arm-none-eabi-size 결과 (text/data/bss)
+  - 맵 파일에서 읽은 함수별 크기 (.text.<함수> 입력 섹션)
+  - QEMU에서 측정한 실행 명령어 수 (icount, -icount shift=0 의 가상 시간 - 실제 사이클이 아님)
+를 하나의 비교 표(Markdown)로 만듭니다.
+
+QEMU 측정에는 QEMU 소스의 contrib 플러그인 libinsn.so 가 필요합니다.
+  (qemu 빌드 디렉토리의 tests/plugin/libinsn.so 또는 contrib/plugins)
+플러그인이 없으면 icount 열은 n/a 로 표시됩니다.
+
+사용 예:
+  tools/build_matrix.py --insn-plugin ~/qemu/build/tests/plugin/libinsn.so
+  tools/build_matrix.py --modules 02-memory-layout --variants O2 Os
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# 변형 이름 -> make 변수
+VARIANTS = {
+    'O0':     {'OPT': '-O0', 'LTO': '0'},
+    'O2':     {'OPT': '-O2', 'LTO': '0'},
+    'Os':     {'OPT': '-Os', 'LTO': '0'},
+    'O2-lto': {'OPT': '-O2', 'LTO': '1'},
+}
+
+MAP_SECTION = re.compile(r'^ (?P<name>\.text(?:\.\S+)?)(?:\s+0x(?P<addr>[0-9a-f]+)\s+0x(?P<size>[0-9a-f]+)\s+(?P<obj>\S+))?$')
+MAP_CONT = re.compile(r'^\s+0x(?P<addr>[0-9a-f]+)\s+0x(?P<size>[0-9a-f]+)\s+(?P<obj>\S+)$')
+INSNS = re.compile(r'insns:\s*(\d+)')
+
+
+def modules():
+    return sorted(d for d in os.listdir(ROOT)
+                  if re.match(r'^\d\d-', d) and os.path.exists(os.path.join(ROOT, d, 'Makefile')))
+
+
+def build(module, make_vars, build_dir):
+    """모듈 Makefile에 변수를 넘겨 빌드 (01-04는 BUILD_DIR, 05 이후는 BUILDDIR)"""
+    args = ['make', '-C', os.path.join(ROOT, module), '--no-print-directory',
+            'BUILD_DIR=' + build_dir, 'BUILDDIR=' + build_dir]
+    args += ['%s=%s' % kv for kv in make_vars.items()]
+    subprocess.run(args + ['clean'], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    result = subprocess.run(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        return None
+    elfs = glob.glob(os.path.join(ROOT, module, build_dir, '*.elf'))
+    return elfs[0] if elfs else None
+
+
+def size_of(elf, cross):
+    out = subprocess.run([cross + 'size', elf], stdout=subprocess.PIPE,
+                         universal_newlines=True, check=True).stdout.splitlines()
+    text, data, bss = out[1].split()[:3]
+    return int(text), int(data), int(bss)
+
+
+def function_sizes(map_file):
+    """맵 파일의 'Linker script and memory map' 이후 .text* 입력 섹션 크기"""
+    sizes = {}
+    if not os.path.exists(map_file):
+        return sizes
+    in_memory_map, pending = False, None
+    with open(map_file) as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if line.startswith('Linker script and memory map'):
+                in_memory_map = True
+                continue
+            if not in_memory_map:
+                continue
+            if pending:
+                m = MAP_CONT.match(line)
+                if m:
+                    record(sizes, pending, m)
+                pending = None
+                continue
+            m = MAP_SECTION.match(line)
+            if not m:
+                continue
+            if m.group('size') is None:
+                pending = m.group('name')  # 긴 섹션 이름은 다음 줄에 주소/크기가 옴
+            else:
+                record(sizes, m.group('name'), m)
+    return sizes
+
+
+def record(sizes, section, m):
+    size = int(m.group('size'), 16)
+    if size == 0:
+        return
+    if section == '.text':
+        name = '.text(%s)' % os.path.basename(m.group('obj'))
+    else:
+        name = section[len('.text.'):]
+    sizes[name] = sizes.get(name, 0) + size
+
+
+def qemu_icount(elf, plugin, timeout):
+    """QEMU -icount shift=0 에서 libinsn 플러그인이 센 실행 명령어 수.
+    05-07처럼 wfi 루프로 끝나는 모듈은 timeout 후 종료되며, 정지 중에는 수가 늘지 않음."""
+    if not plugin:
+        return None
+    with tempfile.NamedTemporaryFile(suffix='.log', delete=False) as log:
+        log_path = log.name
+    try:
+        subprocess.run(['timeout', str(timeout), 'qemu-system-arm',
+                        '-machine', 'mps2-an505', '-cpu', 'cortex-m33',
+                        '-kernel', elf, '-nographic', '-monitor', 'none',
+                        '-semihosting-config', 'enable=on,target=native',
+                        '-icount', 'shift=0',
+                        '-plugin', plugin, '-d', 'plugin', '-D', log_path],
+                       stdin=subprocess.DEVNULL, stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL)
+        with open(log_path) as f:
+            m = INSNS.search(f.read())
+        return int(m.group(1)) if m else None
+    finally:
+        os.unlink(log_path)
+
+
+def fmt(value):
+    return 'n/a' if value is None else str(value)
+
+
+def report(results, variants):
+    lines = ['# Build Variant Matrix', '',
+             'icount: QEMU `-icount shift=0` 에서 센 실행 명령어 수 (명령어에 비례하는 가상 시간, 실제 사이클 아님)', '',
+             '| 모듈 | 변형 | text | data | bss | icount |',
+             '|------|------|-----:|-----:|----:|-------:|']
+    for module in results:
+        for variant in variants:
+            r = results[module].get(variant)
+            if r is None:
+                lines.append('| %s | %s | build failed | | | |' % (module, variant))
+                continue
+            lines.append('| %s | %s | %d | %d | %d | %s |'
+                         % (module, variant, r['text'], r['data'], r['bss'], fmt(r['icount'])))
+
+    for module in results:
+        built = [v for v in variants if results[module].get(v)]
+        if not built:
+            continue
+        functions = set()
+        for v in built:
+            functions.update(results[module][v]['functions'])
+        lines += ['', '## %s - 함수별 크기 (bytes)' % module, '',
+                  '| 함수 | ' + ' | '.join(built) + ' |',
+                  '|------|' + '|'.join('-----:' for _ in built) + '|']
+        base = results[module][built[0]]['functions']
+        for name in sorted(functions, key=lambda n: (-base.get(n, 0), n)):
+            cells = [fmt(results[module][v]['functions'].get(name)) for v in built]
+            lines.append('| %s | %s |' % (name, ' | '.join(cells)))
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--modules', nargs='*', default=None)
+    parser.add_argument('--variants', nargs='*', default=list(VARIANTS), choices=list(VARIANTS))
+    parser.add_argument('--insn-plugin', default=os.environ.get('QEMU_INSN_PLUGIN'))
+    parser.add_argument('--timeout', type=int, default=10)
+    parser.add_argument('--cross', default='arm-none-eabi-')
+    parser.add_argument('--output', default=os.path.join(ROOT, 'build-matrix', 'report.md'))
+    args = parser.parse_args()
+
+    results = {}
+    for module in args.modules or modules():
+        results[module] = {}
+        for variant in args.variants:
+            build_dir = 'build/matrix-' + variant
+            print('[%s] %s ...' % (module, variant))
+            elf = build(module, VARIANTS[variant], build_dir)
+            if not elf:
+                results[module][variant] = None
+                continue
+            text, data, bss = size_of(elf, args.cross)
+            results[module][variant] = {
+                'text': text, 'data': data, 'bss': bss,
+                'functions': function_sizes(os.path.splitext(elf)[0] + '.map'),
+                'icount': qemu_icount(elf, args.insn_plugin, args.timeout),
+            }
+
+    table = report(results, args.variants)
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, 'w') as f:
+        f.write(table)
+    print('')
+    print(table)
+    print('Report written to ' + os.path.relpath(args.output, ROOT))
+    return 0 if all(all(r.values()) for r in results.values()) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+섹션 GC 절감량 리포트
+
+각 모듈을 GC=0(--gc-sections 없음)과 GC=1로 빌드해서 text/data/bss 차이와
+GC가 제거한 함수/변수 목록(맵 파일의 'Discarded input sections')을 보여줍니다.
+
+사용 예:
+  tools/gc_report.py
+  tools/gc_report.py --modules 04-heap-implementation --opt -O0
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from build_matrix import ROOT, build, modules, size_of
+
+DISCARDED = re.compile(r'^ \.(?:text|rodata|data|bss)\.(?P<name>\S+)')
+
+
+def discarded(map_file):
+    """GC=1 맵 파일에서 제거된 입력 섹션 이름 (.text.foo -> foo)"""
+    names = []
+    if not os.path.exists(map_file):
+        return names
+    with open(map_file) as f:
+        in_discarded = False
+        for line in f:
+            if line.startswith('Discarded input sections'):
+                in_discarded = True
+                continue
+            if line.startswith('Memory Configuration'):
+                break
+            m = DISCARDED.match(line) if in_discarded else None
+            if m and m.group('name') not in names:
+                names.append(m.group('name'))
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--modules', nargs='*', default=None)
+    parser.add_argument('--opt', default=None, help='OPT 덮어쓰기 (기본: 모듈 Makefile 값)')
+    parser.add_argument('--cross', default='arm-none-eabi-')
+    args = parser.parse_args()
+
+    rows, removed, ok = [], {}, True
+    for module in args.modules or modules():
+        sizes = {}
+        for gc in ('0', '1'):
+            make_vars = {'GC': gc}
+            if args.opt:
+                make_vars['OPT'] = args.opt
+            elf = build(module, make_vars, 'build/gc-' + gc)
+            if not elf:
+                ok = False
+                break
+            sizes[gc] = size_of(elf, args.cross)
+            if gc == '1':
+                removed[module] = discarded(os.path.splitext(elf)[0] + '.map')
+        if len(sizes) == 2:
+            before, after = sum(sizes['0']), sum(sizes['1'])
+            rows.append((module, sizes['0'], sizes['1'], before - after,
+                         100.0 * (before - after) / before if before else 0.0))
+
+    print('| 모듈 | text/data/bss (GC=0) | text/data/bss (GC=1) | 절감 | % |')
+    print('|------|---------------------:|---------------------:|-----:|--:|')
+    for module, before, after, saved, pct in rows:
+        print('| %s | %d/%d/%d | %d/%d/%d | %d | %.1f |'
+              % ((module,) + before + after + (saved, pct)))
+    print('')
+    for module, names in removed.items():
+        print('%s: removed %s' % (module, ', '.join(names) if names else '(nothing)'))
+    return 0 if ok else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
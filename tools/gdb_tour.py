@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""
+GDB 브레이크포인트 투어 자동 실행 (Python GDB API)
+
+05-07의 asm volatile ("nop"); // Breakpoint N 마커를 GDB로 하나씩 밟는 과정을 배치 작업으로 만듭니다.
+  1. 모듈을 빌드하고 ELF에서 모든 마커 주소를 찾습니다 (tools/profile.py 와 같은 방법).
+  2. QEMU를 -S 로 띄우고 GDB를 -batch 로 연결해 이 파일을 GDB 안에서 다시 실행합니다.
+  3. 마커에서 멈출 때마다 r0-r12, SP, LR, PC, xPSR 과 지정한 메모리를 기록합니다.
+  4. 트레이스(JSON)를 골든 파일과 비교해 달라진 레지스터/메모리를 보고합니다.
+     프로그램이 wfi 루프(05-07) 또는 semihosting 종료에 도달하면 투어가 끝납니다.
+
+사용 예:
+  tools/gdb_tour.py 05-register-alu --update            # 골든 파일 생성/갱신
+  tools/gdb_tour.py 05-register-alu                     # 골든과 비교 (다르면 종료 코드 1)
+  tools/gdb_tour.py 07-variables --memory '&global_array:5' --memory '$sp:16'
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+try:
+    import gdb  # GDB 안에서 실행될 때만 존재
+except ImportError:
+    gdb = None
+
+REGISTERS = ['r0', 'r1', 'r2', 'r3', 'r4', 'r5', 'r6', 'r7', 'r8', 'r9', 'r10', 'r11', 'r12',
+             'sp', 'lr', 'pc', 'xpsr']
+
+
+# ========== GDB 내부 (gdb -x tools/gdb_tour.py) ==========
+
+def capture_memory(spec):
+    """'식:워드 수' -> 그 주소부터 워드 목록 (평가할 수 없으면 None)"""
+    expr, _, words = spec.rpartition(':')
+    if not expr:
+        expr, words = words, '4'
+    try:
+        addr = int(gdb.parse_and_eval(expr)) & 0xFFFFFFFF
+        data = gdb.selected_inferior().read_memory(addr, int(words) * 4).tobytes()
+    except gdb.error:
+        return None
+    return {'address': '0x%08x' % addr,
+            'words': ['0x%08x' % int.from_bytes(data[i:i + 4], 'little')
+                      for i in range(0, len(data), 4)]}
+
+
+def function_at(pc):
+    block = gdb.block_for_pc(pc)
+    return block.function.name if block is not None and block.function else None
+
+
+def gdb_main(config):
+    markers = {int(k): v for k, v in config['markers'].items()}
+    ends = set(config['ends'])
+    for addr in list(markers) + list(ends):
+        gdb.Breakpoint('*0x%x' % addr, internal=True)
+
+    stops, hits = [], {}
+    while len(stops) < config['max_stops']:
+        try:
+            gdb.execute('continue', to_string=True)
+        except gdb.error:
+            break  # semihosting SYS_EXIT 로 QEMU 종료
+        pc = int(gdb.parse_and_eval('$pc')) & ~1
+        if pc in ends or pc not in markers:
+            break
+        marker = markers[pc]
+        hits[pc] = hits.get(pc, 0) + 1
+        stops.append({
+            'marker': marker['num'],
+            'hit': hits[pc],
+            'where': marker['where'],
+            'function': function_at(pc),
+            'note': marker['note'],
+            'registers': {r: '0x%08x' % (int(gdb.parse_and_eval('$' + r)) & 0xFFFFFFFF)
+                          for r in REGISTERS},
+            'memory': {spec: capture_memory(spec) for spec in config['memory']},
+        })
+
+    with open(config['output'], 'w') as f:
+        json.dump({'stops': stops}, f, indent=2, ensure_ascii=False)
+
+
+# ========== 호스트 (드라이버) ==========
+
+def wfi_addresses(elf, objdump):
+    from profile import OBJDUMP_INSN, run
+    ends = []
+    for line in run([objdump, '-d', elf]).splitlines():
+        m = OBJDUMP_INSN.match(line)
+        if m and m.group('mnemonic') == 'wfi':
+            ends.append(int(m.group('addr'), 16))
+    return ends
+
+
+def run_tour(elf, args, output):
+    from profile import find_markers
+    markers = find_markers(elf, args.cross + 'objdump')
+    if not markers:
+        print('ERROR: no Breakpoint markers in %s' % elf)
+        return None
+    config = {
+        'markers': {str(addr): {'num': num, 'note': note, 'where': where}
+                    for addr, (num, note, where) in markers.items()},
+        'ends': wfi_addresses(elf, args.cross + 'objdump'),
+        'memory': args.memory,
+        'max_stops': args.max_stops,
+        'output': output,
+    }
+    with tempfile.NamedTemporaryFile('w', suffix='.json', delete=False) as f:
+        json.dump(config, f)
+        config_path = f.name
+
+    # -icount: 타이머로 사이클을 재는 모듈(05 branchless 벤치마크)도 값이 결정적
+    qemu = subprocess.Popen(['qemu-system-arm', '-machine', 'mps2-an505', '-cpu', 'cortex-m33',
+                             '-kernel', elf, '-nographic', '-monitor', 'none',
+                             '-semihosting-config', 'enable=on,target=native',
+                             '-icount', 'shift=6', '-gdb', 'tcp::%d' % args.port, '-S'],
+                            stdin=subprocess.DEVNULL, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    try:
+        env = dict(os.environ, GDB_TOUR_CONFIG=config_path)
+        subprocess.run(['timeout', str(args.timeout), args.gdb, '-nx', '-batch',
+                        '-ex', 'set pagination off',
+                        '-ex', 'file ' + elf,
+                        '-ex', 'target remote :%d' % args.port,
+                        '-x', os.path.abspath(__file__)],
+                       env=env, stdin=subprocess.DEVNULL, stdout=subprocess.DEVNULL)
+    finally:
+        qemu.kill()
+        qemu.wait()
+        os.unlink(config_path)
+
+    if not os.path.exists(output):
+        print('ERROR: GDB did not produce a trace')
+        return None
+    with open(output) as f:
+        return json.load(f)['stops']
+
+
+def label(stop):
+    return 'BP%d#%d (%s)' % (stop['marker'], stop['hit'], stop['where'])
+
+
+def diff(golden, trace):
+    """스텝별 비교: 마커 순서, 레지스터, 메모리"""
+    lines = []
+    for i in range(max(len(golden), len(trace))):
+        if i >= len(trace):
+            lines.append('stop %d: missing %s' % (i, label(golden[i])))
+            continue
+        if i >= len(golden):
+            lines.append('stop %d: extra %s' % (i, label(trace[i])))
+            continue
+        g, t = golden[i], trace[i]
+        if (g['marker'], g['hit']) != (t['marker'], t['hit']):
+            lines.append('stop %d: expected %s, got %s' % (i, label(g), label(t)))
+            break  # 순서가 어긋나면 이후 비교는 의미 없음
+        for reg in REGISTERS:
+            if g['registers'].get(reg) != t['registers'].get(reg):
+                lines.append('stop %d %s: %s %s -> %s' % (i, label(t), reg,
+                                                         g['registers'].get(reg), t['registers'].get(reg)))
+        for spec in sorted(set(g['memory']) | set(t['memory'])):
+            gm, tm = g['memory'].get(spec), t['memory'].get(spec)
+            if gm != tm:
+                lines.append('stop %d %s: memory %s %s -> %s' % (i, label(t), spec,
+                                                                json.dumps(gm), json.dumps(tm)))
+    return lines
+
+
+def main():
+    from build_matrix import ROOT, build
+
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('module', help='모듈 디렉토리 (예: 05-register-alu)')
+    parser.add_argument('--golden', help='골든 트레이스 (기본: <모듈>/gdb-tour.golden.json)')
+    parser.add_argument('--update', action='store_true', help='골든 파일을 새 트레이스로 갱신')
+    parser.add_argument('--output', help='이번 트레이스 저장 위치 (기본: <모듈>/build/tour/gdb-tour.json)')
+    parser.add_argument('--memory', action='append', default=None, metavar='EXPR[:WORDS]',
+                        help='멈출 때마다 읽을 메모리 (기본: $sp:8)')
+    parser.add_argument('--max-stops', type=int, default=500)
+    parser.add_argument('--timeout', type=int, default=60)
+    parser.add_argument('--port', type=int, default=1234)
+    parser.add_argument('--gdb', default='gdb-multiarch')
+    parser.add_argument('--cross', default='arm-none-eabi-')
+    args = parser.parse_args()
+    args.memory = args.memory or ['$sp:8']
+
+    module = args.module.rstrip('/')
+    elf = build(module, {}, 'build/tour')
+    if not elf:
+        print('ERROR: build failed')
+        return 1
+    output = args.output or os.path.join(ROOT, module, 'build', 'tour', 'gdb-tour.json')
+    golden = args.golden or os.path.join(ROOT, module, 'gdb-tour.golden.json')
+
+    trace = run_tour(elf, args, output)
+    if trace is None:
+        return 1
+    print('%s: %d stops, %d markers visited (trace: %s)'
+          % (module, len(trace), len({s['marker'] for s in trace}), os.path.relpath(output, ROOT)))
+
+    if args.update:
+        with open(golden, 'w') as f:
+            json.dump({'stops': trace}, f, indent=2, ensure_ascii=False)
+            f.write('\n')
+        print('Golden updated: ' + os.path.relpath(golden, ROOT))
+        return 0
+    if not os.path.exists(golden):
+        print('No golden file (%s) - run with --update first' % os.path.relpath(golden, ROOT))
+        return 1
+    with open(golden) as f:
+        differences = diff(json.load(f)['stops'], trace)
+    for line in differences:
+        print('  ' + line)
+    print('FAILED: %d difference(s)' % len(differences) if differences else 'OK: trace matches golden')
+    return 1 if differences else 0
+
+
+if __name__ == '__main__':
+    if gdb is not None:
+        with open(os.environ['GDB_TOUR_CONFIG']) as f:
+            gdb_main(json.load(f))
+    else:
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        sys.exit(main())
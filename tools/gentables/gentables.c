@@ -0,0 +1,134 @@
+/*
+ * 빌드 시 상수 테이블 생성기 (호스트에서 실행)
+ *
+ * 모듈 Makefile 이 호스트 컴파일러로 빌드해 실행하고, 결과를 build/ 에 둡니다.
+ *   gentables header > build/gen_tables.h
+ *   gentables source > build/gen_tables.c
+ *
+ * 모든 테이블은 const 이므로 .rodata.* 로 가고, 링커 스크립트가 .text 출력 섹션
+ * (S_CODE_BOOT) 에 모읍니다. 원소 크기 이상으로 정렬해 원소 하나를 명령어 하나
+ * (LDRB/LDRH/LDR) 로 읽습니다.
+ *
+ *   gen_dec_pairs[200]    "00".."99"       정수 -> 10진 문자열 (나눗셈 절반)
+ *   gen_hex_digits[16]    "0..F"           니블 -> 16진 문자
+ *   gen_hex_pairs[512]    "00".."FF"       바이트 -> 16진 문자 2개
+ *   gen_pow2_u32[32]      1 << n
+ *   gen_pow10_u32[10]     10^n
+ *   gen_crc32_table[256]  CRC-32 (IEEE 802.3, 반사 다항식 0xEDB88320)
+ *   gen_sin_q15[256]      sin(2*pi*i/256), Q15
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SIN_ENTRIES 256
+
+/* M_PI 는 POSIX 확장이라 -std=c99 -pedantic 에서는 정의되지 않음 */
+#define GEN_PI 3.14159265358979323846
+
+static const char *header =
+    "/* 자동 생성 파일 - tools/gentables/gentables.c (수정하지 마세요) */\n"
+    "\n"
+    "#ifndef GEN_TABLES_H\n"
+    "#define GEN_TABLES_H\n"
+    "\n"
+    "#include <stdint.h>\n"
+    "\n"
+    "#define GEN_SIN_ENTRIES %d\n"
+    "\n"
+    "extern const char gen_dec_pairs[200];\n"
+    "extern const char gen_hex_digits[16];\n"
+    "extern const char gen_hex_pairs[512];\n"
+    "extern const uint32_t gen_pow2_u32[32];\n"
+    "extern const uint32_t gen_pow10_u32[10];\n"
+    "extern const uint32_t gen_crc32_table[256];\n"
+    "extern const int16_t gen_sin_q15[GEN_SIN_ENTRIES];\n"
+    "\n"
+    "/* CRC-32: 초기값 0, 바이트당 테이블 조회 1회 (gen_crc32(0, \"123456789\", 9) = 0xCBF43926) */\n"
+    "static inline uint32_t gen_crc32(uint32_t crc, const void *data, uint32_t len) {\n"
+    "    const uint8_t *p = data;\n"
+    "    crc = ~crc;\n"
+    "    while (len--) {\n"
+    "        crc = gen_crc32_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);\n"
+    "    }\n"
+    "    return ~crc;\n"
+    "}\n"
+    "\n"
+    "#endif /* GEN_TABLES_H */\n";
+
+static void emit_chars(const char *name, const char *data, int len) {
+    printf("const char %s[%d] __attribute__((aligned(4))) = {\n", name, len);
+    for (int i = 0; i < len; i++) {
+        printf("%s'%c',%s", i % 16 == 0 ? "    " : "", data[i], i % 16 == 15 || i == len - 1 ? "\n" : " ");
+    }
+    printf("};\n\n");
+}
+
+static void emit_u32(const char *name, const uint32_t *data, int len) {
+    printf("const uint32_t %s[%d] __attribute__((aligned(4))) = {\n", name, len);
+    for (int i = 0; i < len; i++) {
+        printf("%s0x%08Xu,%s", i % 6 == 0 ? "    " : "", data[i], i % 6 == 5 || i == len - 1 ? "\n" : " ");
+    }
+    printf("};\n\n");
+}
+
+static void emit_source(void) {
+    static const char hex[] = "0123456789ABCDEF";
+    char dec_pairs[200], hex_pairs[512];
+    uint32_t pow2[32], pow10[10], crc[256];
+    
+    for (int i = 0; i < 100; i++) {
+        dec_pairs[2 * i] = '0' + i / 10;
+        dec_pairs[2 * i + 1] = '0' + i % 10;
+    }
+    for (int i = 0; i < 256; i++) {
+        hex_pairs[2 * i] = hex[i >> 4];
+        hex_pairs[2 * i + 1] = hex[i & 0xF];
+    }
+    for (int i = 0; i < 32; i++) {
+        pow2[i] = 1u << i;
+    }
+    pow10[0] = 1;
+    for (int i = 1; i < 10; i++) {
+        pow10[i] = pow10[i - 1] * 10;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc[i] = c;
+    }
+    
+    printf("/* 자동 생성 파일 - tools/gentables/gentables.c (수정하지 마세요) */\n\n");
+    printf("#include \"gen_tables.h\"\n\n");
+    emit_chars("gen_dec_pairs", dec_pairs, 200);
+    emit_chars("gen_hex_digits", hex, 16);
+    emit_chars("gen_hex_pairs", hex_pairs, 512);
+    emit_u32("gen_pow2_u32", pow2, 32);
+    emit_u32("gen_pow10_u32", pow10, 10);
+    emit_u32("gen_crc32_table", crc, 256);
+    
+    printf("const int16_t gen_sin_q15[GEN_SIN_ENTRIES] __attribute__((aligned(4))) = {\n");
+    for (int i = 0; i < SIN_ENTRIES; i++) {
+        long v = lround(sin(2.0 * GEN_PI * i / SIN_ENTRIES) * 32768.0);
+        if (v > 32767) v = 32767;   /* sin(pi/2) = 1.0 은 Q15 최댓값으로 포화 */
+        printf("%s%6ld,%s", i % 8 == 0 ? "    " : "", v, i % 8 == 7 ? "\n" : " ");
+    }
+    printf("};\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "header") == 0) {
+        printf(header, SIN_ENTRIES);
+        return 0;
+    }
+    if (argc == 2 && strcmp(argv[1], "source") == 0) {
+        emit_source();
+        return 0;
+    }
+    fprintf(stderr, "usage: %s header|source\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+QEMU 플러그인 기반 실행 프로파일 (함수 / Breakpoint 마커 / 기본 블록)
+
+05-07 모듈의 asm volatile ("nop"); // Breakpoint N 마커를 GDB로 하나씩 밟는 대신,
+tools/qemu-plugin/libinsn_profile.so 로 모듈 전체를 한 번 실행하고
+  - 함수별 실행 명령어 수 (핫스팟)
+  - 마커별 실행 횟수 (소스 위치와 함께)
+  - 가장 많이 실행된 기본 블록
+을 ELF 심볼로 해석해 보여줍니다.
+
+플러그인 빌드:
+  make -C tools/qemu-plugin QEMU_INCLUDE=~/qemu/include/qemu
+
+사용 예:
+  tools/profile.py 05-register-alu
+  tools/profile.py 06-memory-pc --top 30 --output build-profile/06.txt
+  tools/profile.py --elf 08-dsp-simd/build/cortex-m33-dsp-simd.elf --raw profile.raw
+"""
+
+import argparse
+import bisect
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+from build_matrix import ROOT, build
+
+DEFAULT_PLUGIN = os.path.join(ROOT, 'tools', 'qemu-plugin', 'libinsn_profile.so')
+
+NM_LINE = re.compile(r'^(?P<addr>[0-9a-f]+)\s+(?:(?P<size>[0-9a-f]+)\s+)?(?P<type>\w)\s+(?P<name>\S+)$')
+OBJDUMP_LINE = re.compile(r'^(?P<file>/?[^\s:][^:]*):(?P<line>\d+)(?: \(discriminator \d+\))?$')
+OBJDUMP_INSN = re.compile(r'^\s*(?P<addr>[0-9a-f]+):\s+(?:[0-9a-f]{4}\s?)+\s+(?P<mnemonic>\S+)')
+MARKER = re.compile(r'Breakpoint\s+(?P<num>\d+)\s*:?\s*(?P<note>.*)$')
+
+
+def run(cmd):
+    return subprocess.run(cmd, check=True, stdout=subprocess.PIPE,
+                          universal_newlines=True).stdout
+
+
+class Symbols:
+    """nm -S 의 함수 심볼로 주소 -> 함수+오프셋 해석"""
+
+    def __init__(self, elf, nm):
+        funcs = []
+        for line in run([nm, '-S', '-n', '--defined-only', elf]).splitlines():
+            m = NM_LINE.match(line)
+            if m and m.group('type') in 'Tt' and not m.group('name').startswith('$'):
+                size = int(m.group('size'), 16) if m.group('size') else 0
+                funcs.append((int(m.group('addr'), 16) & ~1, size, m.group('name')))
+        # 크기가 없는 어셈블리 레이블은 다음 심볼까지로 본다
+        self.starts, self.ends, self.names = [], [], []
+        for i, (addr, size, name) in enumerate(funcs):
+            if self.starts and self.starts[-1] == addr:
+                continue
+            end = addr + size if size else (funcs[i + 1][0] if i + 1 < len(funcs) else addr + 4)
+            self.starts.append(addr)
+            self.ends.append(end)
+            self.names.append(name)
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0 or addr >= self.ends[i]:
+            return None, 0
+        return self.names[i], addr - self.starts[i]
+
+    def label(self, addr):
+        name, offset = self.lookup(addr)
+        if name is None:
+            return '0x%08x' % addr
+        return name if offset == 0 else '%s+0x%x' % (name, offset)
+
+
+def read_source(path, elf):
+    """DWARF 경로가 상대 경로(src/main.c)면 ELF 상위 디렉토리(모듈)에서 찾는다"""
+    candidates = [path]
+    d = os.path.dirname(os.path.abspath(elf))
+    while d != os.path.dirname(d):
+        candidates.append(os.path.join(d, path))
+        d = os.path.dirname(d)
+    for candidate in candidates:
+        if os.path.isfile(candidate):
+            with open(candidate, errors='replace') as f:
+                return f.read().splitlines()
+    return []
+
+
+def find_markers(elf, objdump):
+    """objdump -d -l 로 nop 명령어의 소스 줄을 찾고, 그 줄의 'Breakpoint N' 주석을 읽는다"""
+    markers = {}
+    sources = {}
+    location = None
+    for line in run([objdump, '-d', '-l', elf]).splitlines():
+        m = OBJDUMP_LINE.match(line)
+        if m:
+            location = (m.group('file'), int(m.group('line')))
+            continue
+        m = OBJDUMP_INSN.match(line)
+        if not m or m.group('mnemonic') != 'nop' or location is None:
+            continue
+        path, lineno = location
+        if path not in sources:
+            sources[path] = read_source(path, elf)
+        text = sources[path][lineno - 1] if 0 < lineno <= len(sources[path]) else ''
+        mm = MARKER.search(text)
+        if mm:
+            markers[int(m.group('addr'), 16)] = (int(mm.group('num')), mm.group('note').strip(),
+                                                 '%s:%d' % (os.path.basename(path), lineno))
+    return markers
+
+
+def run_qemu(elf, plugin, timeout, raw):
+    """05-07 처럼 wfi 루프로 끝나는 모듈은 timeout 으로 종료 (플러그인은 종료 시 출력)"""
+    subprocess.run(['timeout', str(timeout), 'qemu-system-arm',
+                    '-machine', 'mps2-an505', '-cpu', 'cortex-m33',
+                    '-kernel', elf, '-nographic', '-monitor', 'none',
+                    '-semihosting-config', 'enable=on,target=native',
+                    '-plugin', '%s,outfile=%s' % (plugin, raw)],
+                   stdin=subprocess.DEVNULL, stdout=subprocess.DEVNULL,
+                   stderr=subprocess.DEVNULL)
+
+
+def parse_raw(raw):
+    """플러그인 출력: <실행 횟수> <명령어 수> <주소...>"""
+    blocks = []
+    with open(raw) as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) < 3:
+                continue
+            count, n = int(parts[0]), int(parts[1])
+            insns = [int(a, 16) for a in parts[2:2 + n]]
+            blocks.append((insns[0], count, insns))
+    return blocks
+
+
+def report(blocks, symbols, markers, top):
+    insn_count = {}
+    for _, count, insns in blocks:
+        for addr in insns:
+            insn_count[addr] = insn_count.get(addr, 0) + count
+    total = sum(insn_count.values())
+
+    funcs, entries = {}, {}
+    for addr, count in insn_count.items():
+        name, offset = symbols.lookup(addr)
+        name = name or '(unknown)'
+        funcs[name] = funcs.get(name, 0) + count
+        if offset == 0:
+            entries[name] = entries.get(name, 0) + count
+
+    lines = ['=== Instruction Profile ===',
+             'Total executed instructions: %d' % total, '',
+             'Hot functions:',
+             '  %-32s %12s %7s %10s' % ('function', 'insns', '%', 'entries')]
+    for name, count in sorted(funcs.items(), key=lambda kv: -kv[1])[:top]:
+        lines.append('  %-32s %12d %6.2f%% %10d'
+                     % (name, count, 100.0 * count / total if total else 0, entries.get(name, 0)))
+
+    lines += ['', 'Breakpoint markers:',
+              '  %-6s %10s  %-24s %-28s %s' % ('marker', 'hits', 'location', 'function', 'note')]
+    if not markers:
+        lines.append('  (none)')
+    for addr, (num, note, where) in sorted(markers.items(), key=lambda kv: (kv[1][0], kv[0])):
+        lines.append('  %-6s %10d  %-24s %-28s %s'
+                     % ('BP%d' % num, insn_count.get(addr, 0), where, symbols.label(addr), note))
+
+    merged = {}
+    for start, count, insns in blocks:
+        key = (start, len(insns))
+        merged[key] = merged.get(key, 0) + count
+    lines += ['', 'Hot basic blocks:',
+              '  %-10s %-36s %6s %10s %12s' % ('address', 'symbol', 'insns', 'execs', 'total')]
+    ranked = sorted(merged.items(), key=lambda kv: -kv[1] * kv[0][1])[:top]
+    for (start, n), count in ranked:
+        lines.append('  0x%08x %-36s %6d %10d %12d' % (start, symbols.label(start), n, count, n * count))
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('module', nargs='?', help='모듈 디렉토리 (예: 05-register-alu)')
+    parser.add_argument('--elf', help='이미 빌드된 ELF (module 대신)')
+    parser.add_argument('--plugin', default=os.environ.get('QEMU_PROFILE_PLUGIN', DEFAULT_PLUGIN))
+    parser.add_argument('--raw', help='플러그인 출력 파일 (있으면 QEMU 실행 생략)')
+    parser.add_argument('--timeout', type=int, default=10)
+    parser.add_argument('--top', type=int, default=20)
+    parser.add_argument('--cross', default='arm-none-eabi-')
+    parser.add_argument('--output')
+    args = parser.parse_args()
+
+    elf = args.elf
+    if not elf:
+        if not args.module:
+            parser.error('module 또는 --elf 가 필요합니다')
+        elf = build(args.module.rstrip('/'), {}, 'build/profile')
+        if not elf:
+            print('ERROR: build failed')
+            return 1
+
+    raw, temporary = args.raw, False
+    if not raw or not os.path.exists(raw):
+        if not os.path.exists(args.plugin):
+            print('ERROR: plugin not found: %s (make -C tools/qemu-plugin)' % args.plugin)
+            return 1
+        if not raw:
+            fd, raw = tempfile.mkstemp(suffix='.raw')
+            os.close(fd)
+            temporary = True
+        run_qemu(elf, args.plugin, args.timeout, raw)
+
+    blocks = parse_raw(raw)
+    if temporary:
+        os.unlink(raw)
+    if not blocks:
+        print('ERROR: no profile data in %s' % raw)
+        return 1
+
+    text = report(blocks, Symbols(elf, args.cross + 'nm'),
+                  find_markers(elf, args.cross + 'objdump'), args.top)
+    if args.output:
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, 'w') as f:
+            f.write(text)
+    print(text, end='')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
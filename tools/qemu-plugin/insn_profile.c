@@ -0,0 +1,124 @@
+/*
+ * QEMU TCG 플러그인: 기본 블록(TB)별 실행 횟수 기록
+ *
+ * 블록마다 시작 주소, 명령어 주소 목록, 실행 횟수를 모아 종료 시 텍스트로 출력합니다.
+ * 심볼 해석(함수, "Breakpoint N" 마커)은 tools/profile.py 가 ELF 에서 합니다.
+ *
+ * 출력 형식 (한 줄에 블록 하나):
+ *   <실행 횟수> <명령어 수> <주소0> <주소1> ...      (주소는 16진수)
+ *
+ * 사용 예:
+ *   qemu-system-arm ... -plugin ./libinsn_profile.so,outfile=profile.raw
+ *   (outfile 을 주지 않으면 -d plugin -D <로그> 로 출력)
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+typedef struct {
+    uint64_t vaddr;
+    uint64_t count;         /* 블록 실행 횟수 */
+    size_t n_insns;
+    uint64_t *insn_vaddr;   /* 명령어별 주소 (마커/함수 경계 판별용) */
+} block_t;
+
+static GHashTable *blocks;      /* vaddr -> block_t (재번역된 TB 는 같은 항목 공유) */
+static GPtrArray *all_blocks;   /* 출력용: 길이가 달라 대체된 항목도 보존 */
+static GMutex lock;
+static char *outfile;
+
+static void vcpu_tb_exec(unsigned int vcpu_index, void *udata) {
+    block_t *block = udata;
+    
+    /* Cortex-M33 은 vCPU 하나 -> 잠금 없이 증가 */
+    block->count++;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb) {
+    uint64_t vaddr = qemu_plugin_tb_vaddr(tb);
+    size_t n = qemu_plugin_tb_n_insns(tb);
+    block_t *block;
+    
+    g_mutex_lock(&lock);
+    block = g_hash_table_lookup(blocks, &vaddr);
+    if (block == NULL || block->n_insns != n) {
+        block = g_new0(block_t, 1);
+        block->vaddr = vaddr;
+        block->n_insns = n;
+        block->insn_vaddr = g_new(uint64_t, n);
+        for (size_t i = 0; i < n; i++) {
+            block->insn_vaddr[i] = qemu_plugin_insn_vaddr(qemu_plugin_tb_get_insn(tb, i));
+        }
+        /* 길이가 다른 재번역(예: 중간에서 끊긴 TB)은 새 항목으로, 이전 항목은 all_blocks 에 남음 */
+        g_hash_table_insert(blocks, &block->vaddr, block);
+        g_ptr_array_add(all_blocks, block);
+    }
+    g_mutex_unlock(&lock);
+    
+    qemu_plugin_register_vcpu_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, block);
+}
+
+static void dump_block(FILE *out, GString *line, const block_t *block) {
+    g_string_printf(line, "%" PRIu64 " %zu", block->count, block->n_insns);
+    for (size_t i = 0; i < block->n_insns; i++) {
+        g_string_append_printf(line, " %" PRIx64, block->insn_vaddr[i]);
+    }
+    g_string_append_c(line, '\n');
+    if (out) {
+        fputs(line->str, out);
+    } else {
+        qemu_plugin_outs(line->str);
+    }
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *p) {
+    GString *line = g_string_new(NULL);
+    FILE *out = NULL;
+    
+    if (outfile) {
+        out = fopen(outfile, "w");
+        if (out == NULL) {
+            g_string_printf(line, "insn_profile: cannot open %s\n", outfile);
+            qemu_plugin_outs(line->str);
+        }
+    }
+    
+    g_mutex_lock(&lock);
+    for (guint i = 0; i < all_blocks->len; i++) {
+        const block_t *block = g_ptr_array_index(all_blocks, i);
+        if (block->count) {
+            dump_block(out, line, block);
+        }
+    }
+    g_mutex_unlock(&lock);
+    
+    if (out) {
+        fclose(out);
+    }
+    g_string_free(line, TRUE);
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+                                           int argc, char **argv) {
+    for (int i = 0; i < argc; i++) {
+        if (strncmp(argv[i], "outfile=", 8) == 0) {
+            outfile = g_strdup(argv[i] + 8);
+        } else {
+            fprintf(stderr, "insn_profile: unknown option %s\n", argv[i]);
+            return -1;
+        }
+    }
+    
+    blocks = g_hash_table_new(g_int64_hash, g_int64_equal);
+    all_blocks = g_ptr_array_new();
+    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}